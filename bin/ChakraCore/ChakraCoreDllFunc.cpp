@@ -98,6 +98,8 @@ static void DetachProcess()
     ThreadContextTLSEntry::CleanupThread();
     ThreadContextTLSEntry::CleanupProcess();
 
+    PageSegmentCache::ReleaseAll();
+
 #if PROFILE_DICTIONARY
     DictionaryStats::OutputStats();
 #endif
@@ -24,6 +24,8 @@ void DoVerify(bool value, const char * expr, const char * file, int line)
 static const unsigned int stackRootCount = 50;
 static const unsigned int globalRootCount = 50;
 static const unsigned int implicitRootCount = 50;
+static const unsigned int ephemeronRootCount = 10;
+static const unsigned int maxEphemeronChainLength = 100;
 
 #ifdef _WIN32
 static const unsigned int initializeCount = 1000000;
@@ -55,6 +57,12 @@ RecyclerTestObject * globalRoots[globalRootCount];
 // Only enabled in MemProtect mode.
 RecyclerTestObject * implicitRoots[implicitRootCount];
 
+// Ephemeron root locations.  These are pinned (if not null).
+// Each owner/key pair heads a chain of ephemerons whose values are only reachable through the recycler's
+// ephemeron table, with each value being the key of the next ephemeron in the chain.
+RecyclerTestObject * ephemeronOwners[ephemeronRootCount];
+RecyclerTestObject * ephemeronKeys[ephemeronRootCount];
+
 // Object creation function table.  Used to randomly create new objects.
 typedef RecyclerTestObject * (*ObjectCreationFunc)(void);
 
@@ -183,6 +191,49 @@ void SwapObjects()
     location2.Set(object);
 }
 
+void AddEphemeronChain()
+{
+    // Pick a random ephemeron root, making sure it has both an owner and a key.
+    // The roots are in the roots table too, so other operations may replace or delete them at any time,
+    // which leaves their chains to be collected.
+    unsigned int index = GetRandomInteger(ephemeronRootCount);
+    Location owner = Location::Rooted(&ephemeronOwners[index]);
+    Location key = Location::Rooted(&ephemeronKeys[index]);
+    if (owner.Get() == nullptr)
+    {
+        owner.Set(CreateNewObject());
+    }
+    if (key.Get() == nullptr)
+    {
+        key.Set(CreateNewObject());
+    }
+
+    // Find the end of the existing chain, then extend it.
+    // Once a chain gets too long, start a new one from a new key and let the old one be collected.
+    RecyclerTestObject * currentKey = key.Get();
+    RecyclerTestObject * value;
+    unsigned int existingLength = 0;
+    while (recyclerInstance->TryGetEphemeron(owner.Get(), currentKey, (void **)&value))
+    {
+        currentKey = value;
+        existingLength++;
+    }
+
+    if (existingLength >= maxEphemeronChainLength * 10)
+    {
+        key.Set(CreateNewObject());
+        currentKey = key.Get();
+    }
+
+    unsigned int length = 1 + GetRandomInteger(maxEphemeronChainLength);
+    for (unsigned int i = 0; i < length; i++)
+    {
+        value = CreateNewObject();
+        recyclerInstance->SetEphemeron(owner.Get(), currentKey, value);
+        currentKey = value;
+    }
+}
+
 void DoHeapOperation()
 {
     // Get a random heap operation routine from the operation table
@@ -203,6 +254,20 @@ void WalkHeap()
         RecyclerTestObject::WalkReference(roots.GetEntry(i).Get());
     }
 
+    // Ephemeron values are only reachable through the ephemeron table, so walk the chains explicitly.
+    // Every value in a chain whose owner and first key are alive must still be alive too.
+    for (unsigned int i = 0; i < ephemeronRootCount; i++)
+    {
+        RecyclerTestObject * owner = ephemeronOwners[i];
+        RecyclerTestObject * key = ephemeronKeys[i];
+        RecyclerTestObject * value;
+        while (owner != nullptr && recyclerInstance->TryGetEphemeron(owner, key, (void **)&value))
+        {
+            RecyclerTestObject::WalkReference(value);
+            key = value;
+        }
+    }
+
     RecyclerTestObject::EndWalk();
 }
 
@@ -241,6 +306,7 @@ void BuildOperationTable()
     operationTable.AddWeightedEntry(&MoveObject, 5);
     operationTable.AddWeightedEntry(&CopyObject, 5);
     operationTable.AddWeightedEntry(&SwapObjects, 5);
+    operationTable.AddWeightedEntry(&AddEphemeronChain, 1);
 }
 
 void SimpleRecyclerTest()
@@ -300,6 +366,15 @@ void SimpleRecyclerTest()
             roots.AddWeightedEntry(Location::Rooted(&globalRoots[i]), 1);
         }
 
+        // Initialize ephemeron roots and add to our roots table
+        for (unsigned int i = 0; i < ephemeronRootCount; i++)
+        {
+            ephemeronOwners[i] = nullptr;
+            ephemeronKeys[i] = nullptr;
+            roots.AddWeightedEntry(Location::Rooted(&ephemeronOwners[i]), 1);
+            roots.AddWeightedEntry(Location::Rooted(&ephemeronKeys[i]), 1);
+        }
+
         // MemProtect only:
         // Initialize implicit roots and add to our roots table        
         if (implicitRootsMode)
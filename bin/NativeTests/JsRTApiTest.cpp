@@ -5,6 +5,8 @@
 #include "stdafx.h"
 #include "catch.hpp"
 #include <process.h>
+#include <io.h>
+#include <vector>
 
 #pragma warning(disable:4100) // unreferenced formal parameter
 #pragma warning(disable:6387) // suppressing preFAST which raises warning for passing null to the JsRT APIs
@@ -43,6 +45,114 @@ namespace JsRTApiTest
         return undefined;
     }
 
+    // A temporary file for the APIs that write to or read from a file descriptor
+    class ScratchFile
+    {
+    public:
+        ScratchFile() : file(nullptr), fd(-1)
+        {
+            REQUIRE(tmpfile_s(&file) == 0);
+            fd = _fileno(file);
+        }
+
+        ~ScratchFile()
+        {
+            fclose(file);
+        }
+
+        int GetFileDescriptor() const { return fd; }
+
+        void Rewind()
+        {
+            REQUIRE(_lseek(fd, 0, SEEK_SET) == 0);
+        }
+
+        std::string ReadAll()
+        {
+            std::string contents;
+            char buffer[4096];
+            int read;
+            Rewind();
+            while ((read = _read(fd, buffer, sizeof(buffer))) > 0)
+            {
+                contents.append(buffer, read);
+            }
+            REQUIRE(read == 0);
+            Rewind();
+            return contents;
+        }
+
+    private:
+        FILE * file;
+        int fd;
+    };
+
+    // Replaces the contents of a scratch file and rewinds it, so the next read starts at the beginning
+    void WriteScratchFile(ScratchFile& file, const std::string& contents)
+    {
+        int fd = file.GetFileDescriptor();
+        REQUIRE(_chsize(fd, 0) == 0);
+        REQUIRE(_lseek(fd, 0, SEEK_SET) == 0);
+        if (!contents.empty())
+        {
+            REQUIRE(_write(fd, contents.c_str(), (unsigned int)contents.length()) == (int)contents.length());
+        }
+        REQUIRE(_lseek(fd, 0, SEEK_SET) == 0);
+    }
+
+    // Checks that a cache with a damaged header, damaged records or checksum, or cut short is rejected
+    template <typename LoadCache>
+    void CheckDamagedCacheFilesRejected(JsRuntimeHandle runtime, ScratchFile& file, const std::string& cache, LoadCache load)
+    {
+        struct DamagedCache
+        {
+            const char * description;
+            size_t flippedByte;
+            size_t length;
+        };
+
+        const size_t NoFlip = (size_t)-1;
+        const DamagedCache damagedCaches[] =
+        {
+            { "damaged header", 0, cache.length() },
+            { "damaged records or checksum", cache.length() - 1, cache.length() },
+            { "truncated", NoFlip, cache.length() / 2 },
+        };
+
+        for (const DamagedCache& damagedCache : damagedCaches)
+        {
+            std::string damaged = cache.substr(0, damagedCache.length);
+            if (damagedCache.flippedByte != NoFlip)
+            {
+                damaged[damagedCache.flippedByte] ^= 0xff;
+            }
+
+            INFO(damagedCache.description);
+            WriteScratchFile(file, damaged);
+            CHECK(load(runtime, file.GetFileDescriptor()) == JsErrorInvalidArgument);
+        }
+    }
+
+    void SetGlobalString(const WCHAR * name, const std::string& value)
+    {
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        JsValueRef string = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(name, &propertyId) == JsNoError);
+        REQUIRE(JsCreateString(value.c_str(), value.length(), &string) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, string, true) == JsNoError);
+    }
+
+    bool RunBooleanScript(const WCHAR * script)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool value = false;
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &value) == JsNoError);
+        return value;
+    }
+
     template <class Handler>
     void WithSetup(JsRuntimeAttributes attributes, Handler handler)
     {
@@ -2249,4 +2359,315 @@ namespace JsRTApiTest
     {
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsLessThanTest);
     }
+
+    void GCPauseBudgetTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const unsigned int BucketCount = 16;
+        unsigned int pauseCounts[BucketCount + 2];
+        unsigned int actualBucketCount = 0;
+
+        CHECK(JsGetRuntimeGCPauseHistogram(runtime, nullptr, 1, nullptr) == JsErrorNullArgument);
+        REQUIRE(JsGetRuntimeGCPauseHistogram(runtime, nullptr, 0, &actualBucketCount) == JsNoError);
+        CHECK(actualBucketCount == BucketCount);
+
+        REQUIRE(JsSetRuntimeGCPauseBudget(runtime, 5) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 100000; i++) { a.push({ i: i }); if (a.length > 1000) { a = []; } }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        // Buckets past the ones the runtime keeps are zeroed
+        memset(pauseCounts, 0xff, sizeof(pauseCounts));
+        REQUIRE(JsGetRuntimeGCPauseHistogram(runtime, pauseCounts, BucketCount + 2, &actualBucketCount) == JsNoError);
+        CHECK(actualBucketCount == BucketCount);
+        CHECK(pauseCounts[BucketCount] == 0);
+        CHECK(pauseCounts[BucketCount + 1] == 0);
+
+        unsigned int pauseCount = 0;
+        for (unsigned int i = 0; i < BucketCount; i++)
+        {
+            pauseCount += pauseCounts[i];
+        }
+        CHECK(pauseCount >= 1);
+
+        REQUIRE(JsSetRuntimeGCPauseBudget(runtime, 0) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_GCPauseBudgetTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::GCPauseBudgetTest);
+    }
+
+    void AllocationHistogramTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        unsigned int entryCount = 0;
+        REQUIRE(JsGetRuntimeAllocationHistogram(runtime, nullptr, 0, &entryCount) == JsErrorInvalidArgument);
+        REQUIRE(entryCount > 1);
+        CHECK(JsGetRuntimeAllocationHistogram(runtime, nullptr, 1, nullptr) == JsErrorNullArgument);
+
+        REQUIRE(JsEnableRuntimeAllocationHistogram(runtime) == JsNoError);
+
+        std::vector<JsAllocationHistogramEntry> before(entryCount);
+        REQUIRE(JsGetRuntimeAllocationHistogram(runtime, before.data(), entryCount, nullptr) == JsNoError);
+
+        // 20000 small objects, and 10 arrays whose element storage is too large for a size class
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "var small = []; for (var i = 0; i < 20000; i++) { small.push({ i: i }); }"
+            "var large = []; for (var j = 0; j < 10; j++) { var a = new Array(100000); a.fill(j); large.push(a); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // Entries past the ones the runtime keeps are zeroed
+        std::vector<JsAllocationHistogramEntry> after(entryCount + 1);
+        memset(after.data(), 0xff, after.size() * sizeof(JsAllocationHistogramEntry));
+        REQUIRE(JsGetRuntimeAllocationHistogram(runtime, after.data(), entryCount + 1, nullptr) == JsNoError);
+        CHECK(after[entryCount].allocationCount == 0);
+        CHECK(after[entryCount].bucketSize == 0);
+
+        unsigned long long smallAllocationCount = 0;
+        for (unsigned int i = 0; i < entryCount; i++)
+        {
+            CHECK(after[i].bucketSize == before[i].bucketSize);
+            CHECK(after[i].allocationCount >= before[i].allocationCount);
+            CHECK(after[i].allocatedBytes >= after[i].requestedBytes);
+            if (i + 1 < entryCount)
+            {
+                // The size classes are in increasing size order, and every allocation fits its class
+                CHECK(after[i].bucketSize != 0);
+                CHECK((i == 0 || after[i].bucketSize > after[i - 1].bucketSize));
+                CHECK(after[i].allocatedBytes == after[i].allocationCount * after[i].bucketSize);
+                smallAllocationCount += after[i].allocationCount - before[i].allocationCount;
+            }
+        }
+
+        const JsAllocationHistogramEntry& largeEntry = after[entryCount - 1];
+        CHECK(largeEntry.bucketSize == 0);
+        CHECK(largeEntry.allocationCount - before[entryCount - 1].allocationCount >= 10);
+        CHECK(largeEntry.allocatedBytes - before[entryCount - 1].allocatedBytes >= 10 * 100000 * sizeof(int));
+        CHECK(smallAllocationCount >= 20000);
+    }
+
+    TEST_CASE("ApiTest_AllocationHistogramTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::AllocationHistogramTest);
+    }
+
+    void DedicatedLargeObjectTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        size_t baseUsage = 0;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &baseUsage) == JsNoError);
+
+        // Each array ends up with a segment of about 400KB, above the 256KB dedicated large object size.
+        // Keep a small object allocated right after each one, which used to pin the large block.
+        const size_t arrayCount = 32;
+        const size_t minArrayBytes = 100000 * sizeof(int);
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "var large = [], small = [];"
+            "for (var i = 0; i < 32; i++) {"
+            "  var a = new Array(100000); for (var j = 0; j < a.length; j++) { a[j] = j; }"
+            "  large.push(a); small.push({ i: i });"
+            "}"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        size_t allocatedUsage = 0;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &allocatedUsage) == JsNoError);
+        REQUIRE(allocatedUsage >= baseUsage + arrayCount * minArrayBytes);
+
+        // Drop the large arrays only. Their blocks hold nothing else, so their pages are released when
+        // they are swept, whatever the small objects allocated around them do.
+        REQUIRE(JsRunScript(_u("large = null;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        size_t releasedUsage = 0;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &releasedUsage) == JsNoError);
+        CHECK(releasedUsage + arrayCount * minArrayBytes / 2 <= allocatedUsage);
+
+        bool smallAlive = false;
+        REQUIRE(JsRunScript(_u("small.length === 32 && small[31].i === 31"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &smallAlive) == JsNoError);
+        CHECK(smallAlive);
+    }
+
+    TEST_CASE("ApiTest_DedicatedLargeObjectTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::DedicatedLargeObjectTest);
+    }
+
+    void HeapSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        CHECK(JsWriteHeapSnapshot(runtime, -1) == JsErrorInvalidArgument);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var kept = { heapSnapshotMarker: [1, 2, 3] };"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        ScratchFile file;
+        REQUIRE(JsWriteHeapSnapshot(runtime, file.GetFileDescriptor()) == JsNoError);
+        std::string snapshot = file.ReadAll();
+        REQUIRE(!snapshot.empty());
+
+        // Parse the snapshot and check that its tables agree with its header
+        SetGlobalString(_u("snapshotText"), snapshot);
+        CHECK(RunBooleanScript(_u(
+            "var snapshot = JSON.parse(snapshotText);"
+            "var meta = snapshot.snapshot.meta;"
+            "snapshot.snapshot.node_count > 0 &&"
+            "snapshot.nodes.length === snapshot.snapshot.node_count * meta.node_fields.length &&"
+            "snapshot.edges.length === snapshot.snapshot.edge_count * meta.edge_fields.length &&"
+            "snapshot.strings.indexOf('heapSnapshotMarker') !== -1")));
+    }
+
+    TEST_CASE("ApiTest_HeapSnapshotTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapSnapshotTest);
+    }
+
+    void AllocationSamplingTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        ScratchFile file;
+
+        // There is no profile until sampling is started
+        CHECK(JsWriteAllocationSamplingProfile(runtime, file.GetFileDescriptor()) == JsErrorInvalidArgument);
+
+        REQUIRE(JsStartAllocationSampling(runtime, 1024) == JsNoError);
+
+        // The stack of deep() is deeper than the frames a sample keeps
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "function allocate(n) { var a = []; for (var i = 0; i < n; i++) { a.push(new Array(16)); } return a.length; }"
+            "function deep(depth) { return depth == 0 ? allocate(20000) : deep(depth - 1); }"
+            "allocate(20000);"
+            "deep(100);"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsStopAllocationSampling(runtime) == JsNoError);
+        CHECK(JsWriteAllocationSamplingProfile(runtime, -1) == JsErrorInvalidArgument);
+        REQUIRE(JsWriteAllocationSamplingProfile(runtime, file.GetFileDescriptor()) == JsNoError);
+        std::string profile = file.ReadAll();
+        REQUIRE(!profile.empty());
+
+        SetGlobalString(_u("profileText"), profile);
+        CHECK(RunBooleanScript(_u(
+            "var profile = JSON.parse(profileText);"
+            "function find(node, name) {"
+            "    if (node.callFrame.functionName === name) { return node; }"
+            "    for (var i = 0; i < node.children.length; i++) { var found = find(node.children[i], name); if (found) { return found; } }"
+            "    return null;"
+            "}"
+            "var truncated = profile.head.children.filter(function (node) { return node.callFrame.functionName === '(truncated)'; });"
+            "var complete = profile.head.children.filter(function (node) { return node.callFrame.functionName !== '(truncated)'; });"
+            "profile.head.callFrame.functionName === '(root)' &&"
+            "truncated.length === 1 && find(truncated[0], 'allocate') !== null && find(truncated[0], 'deep') !== null &&"
+            "complete.some(function (node) { return find(node, 'allocate') !== null; })")));
+    }
+
+    TEST_CASE("ApiTest_AllocationSamplingTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::AllocationSamplingTest);
+    }
+
+    void JitWarmupCacheTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        ScratchFile file;
+
+        CHECK(JsWriteJitWarmupCache(runtime, -1) == JsErrorInvalidArgument);
+        CHECK(JsLoadJitWarmupCache(runtime, -1) == JsErrorInvalidArgument);
+
+        // Without a loaded cache, the first write starts an empty one, which loads back
+        REQUIRE(JsWriteJitWarmupCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        CHECK(!file.ReadAll().empty());
+        CHECK(JsLoadJitWarmupCache(runtime, file.GetFileDescriptor()) == JsNoError);
+
+        // An empty file is an empty cache
+        WriteScratchFile(file, "");
+        REQUIRE(JsLoadJitWarmupCache(runtime, file.GetFileDescriptor()) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function hot(a) { return a + 1; } var sum = 0; for (var i = 0; i < 10000; i++) { sum = hot(sum); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsWriteJitWarmupCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        std::string cache = file.ReadAll();
+        REQUIRE(!cache.empty());
+
+        // What was written loads back, and writes out again the same size
+        REQUIRE(JsLoadJitWarmupCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        WriteScratchFile(file, "");
+        REQUIRE(JsWriteJitWarmupCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        CHECK(file.ReadAll().length() == cache.length());
+
+        // A damaged or truncated file is rejected, and the loaded cache is kept
+        CheckDamagedCacheFilesRejected(runtime, file, cache, JsLoadJitWarmupCache);
+
+        WriteScratchFile(file, "");
+        REQUIRE(JsWriteJitWarmupCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        CHECK(file.ReadAll().length() == cache.length());
+    }
+
+    TEST_CASE("ApiTest_JitWarmupCacheTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JitWarmupCacheTest);
+    }
+
+    void DynamicProfileCacheTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        ScratchFile file;
+
+        // There is nothing to write until a cache is loaded
+        JsErrorCode errorCode = JsWriteDynamicProfileCache(runtime, file.GetFileDescriptor());
+        if (errorCode == JsErrorNotImplemented)
+        {
+            // This build doesn't profile
+            CHECK(JsLoadDynamicProfileCache(runtime, file.GetFileDescriptor()) == JsErrorNotImplemented);
+            return;
+        }
+        CHECK(errorCode == JsErrorInvalidArgument);
+        CHECK(JsLoadDynamicProfileCache(runtime, -1) == JsErrorInvalidArgument);
+
+        // An empty file is an empty cache
+        REQUIRE(JsLoadDynamicProfileCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        REQUIRE(JsWriteDynamicProfileCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        const size_t emptyCacheLength = file.ReadAll().length();
+        REQUIRE(emptyCacheLength != 0);
+
+        const WCHAR * script = _u("function hot(o) { return o.a + o.b; } var sum = 0; for (var i = 0; i < 10000; i++) { sum += hot({ a: i, b: 1 }); }");
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        WriteScratchFile(file, "");
+        REQUIRE(JsWriteDynamicProfileCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        std::string cache = file.ReadAll();
+
+        // Functions are only profiled when they can be JIT'ed
+        if (!(attributes & JsRuntimeAttributeDisableNativeCodeGeneration))
+        {
+            CHECK(cache.length() > emptyCacheLength);
+        }
+
+        // What was written loads back, its profiles are deserialized into the functions of a new context, and the
+        // cache writes out again the same size
+        REQUIRE(JsLoadDynamicProfileCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        JsContextRef context = JS_INVALID_REFERENCE;
+        JsContextRef newContext = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&context) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &newContext) == JsNoError);
+        REQUIRE(JsSetCurrentContext(newContext) == JsNoError);
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        WriteScratchFile(file, "");
+        REQUIRE(JsWriteDynamicProfileCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        CHECK(file.ReadAll().length() == cache.length());
+
+        // A damaged or truncated file is rejected, and the loaded cache is kept
+        CheckDamagedCacheFilesRejected(runtime, file, cache, JsLoadDynamicProfileCache);
+
+        WriteScratchFile(file, "");
+        REQUIRE(JsWriteDynamicProfileCache(runtime, file.GetFileDescriptor()) == JsNoError);
+        CHECK(file.ReadAll().length() == cache.length());
+    }
+
+    TEST_CASE("ApiTest_DynamicProfileCacheTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::DynamicProfileCacheTest);
+    }
 }
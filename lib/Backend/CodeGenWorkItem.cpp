@@ -17,6 +17,7 @@ CodeGenWorkItem::CodeGenWorkItem(
     , recyclableData(nullptr)
     , isInJitQueue(false)
     , isAllocationCommitted(false)
+    , queuedTime(0)
     , queuedFullJitWorkItem(nullptr)
     , allocation(nullptr)
 #ifdef IR_VIEWER
@@ -124,6 +125,10 @@ void CodeGenWorkItem::OnAddToJitQueue()
     this->isInJitQueue = true;
     VerifyJitMode();
 
+    LARGE_INTEGER queuedTime;
+    QueryPerformanceCounter(&queuedTime);
+    this->queuedTime = queuedTime.QuadPart;
+
     this->entryPointInfo->SetCodeGenQueued();
     if(IS_JS_ETW(EventEnabledJSCRIPT_FUNCTION_JIT_QUEUED()))
     {
@@ -58,7 +58,8 @@ public:
         return functionBody->GetScriptContext();
     }
 
-    uint GetByteCodeLength() const
+    // Length of the byte code compiled by this work item
+    virtual uint GetByteCodeLength() const
     {
         return this->functionBody->IsInDebugMode()
             ? this->functionBody->GetOriginalByteCode()->GetLength()
@@ -89,6 +90,7 @@ protected:
 private:
     bool isInJitQueue;                  // indicates if the work item has been added to the global jit queue
     bool isAllocationCommitted;         // Whether the EmitBuffer allocation has been committed
+    int64 queuedTime;                   // performance counter value when the work item was last added to the jit queue
 
     QueuedFullJitWorkItem *queuedFullJitWorkItem;
     EmitBufferAllocation<VirtualAllocWrapper, PreReservedVirtualAllocWrapper> *allocation;
@@ -175,6 +177,11 @@ public:
         return isInJitQueue;
     }
 
+    int64 GetQueuedTime() const
+    {
+        return queuedTime;
+    }
+
     bool IsJitInDebugMode() const
     {
         return jitData.isJitInDebugMode != 0;
@@ -283,6 +290,12 @@ struct JsLoopBodyCodeGen sealed : public CodeGenWorkItem
     void SetCodeAddress(uintptr_t codeAddress) { this->codeAddress = codeAddress; }
     uintptr_t GetCodeAddress() const { return codeAddress; }
 
+    uint GetByteCodeLength() const override
+    {
+        // Only the loop is compiled, so the JIT limits apply to the loop rather than to the whole function
+        return loopHeader->endOffset - loopHeader->startOffset;
+    }
+
     uint GetByteCodeCount() const override
     {
         return (loopHeader->endOffset - loopHeader->startOffset) + functionBody->GetConstantCount();
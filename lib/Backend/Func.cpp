@@ -158,7 +158,13 @@ Func::Func(JitArenaAllocator *alloc, JITTimeWorkItem * workItem,
     AssertOrFailFast(!UInt32Math::Add(GetJITFunctionBody()->GetConstCount(), GetJITFunctionBody()->GetVarCount(), &tmpResult));
     AssertOrFailFast(GetJITFunctionBody()->IsAsmJsMode() || GetJITFunctionBody()->GetFirstTmpReg() <= GetJITFunctionBody()->GetLocalsCount());
     AssertOrFailFast(!IsLoopBody() || m_workItem->GetLoopNumber() < GetJITFunctionBody()->GetLoopCount());
-    AssertOrFailFast(CONFIG_FLAG(Prejit) || CONFIG_ISENABLED(Js::ForceNativeFlag) || GetJITFunctionBody()->GetByteCodeLength() < (uint)CONFIG_FLAG(MaxJITFunctionBytecodeByteLength));
+    // A loop body only compiles the byte code of its loop, however large the rest of the function is
+    AssertOrFailFast(
+        CONFIG_FLAG(Prejit) ||
+        CONFIG_ISENABLED(Js::ForceNativeFlag) ||
+        (IsLoopBody() && IsTopFunc()
+            ? m_workItem->GetLoopHeader()->endOffset - m_workItem->GetLoopHeader()->startOffset
+            : GetJITFunctionBody()->GetByteCodeLength()) < (uint)CONFIG_FLAG(MaxJITFunctionBytecodeByteLength));
     GetJITFunctionBody()->EnsureConsistentConstCount();
 
     if (this->IsTopFunc())
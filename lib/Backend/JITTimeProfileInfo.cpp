@@ -96,6 +96,11 @@ JITTimeProfileInfo::InitializeJITProfileData(
     data->loopCount = functionBody->GetLoopCount();
     data->loopImplicitCallFlags = reinterpret_cast<byte*>(profileInfo->GetLoopImplicitCallFlags());
 
+    CompileAssert(sizeof(AllocationSiteIDL) == sizeof(Js::AllocationSiteInfo));
+    // Profiles read back from a cache carry no allocation site data
+    data->allocationSiteCount = profileInfo->GetAllocationSiteInfo() != nullptr ? functionBody->GetObjLiteralCount() : 0;
+    data->allocationSiteData = reinterpret_cast<AllocationSiteIDL*>(profileInfo->GetAllocationSiteInfo());
+
     data->implicitCallFlags = static_cast<byte>(profileInfo->GetImplicitCallFlags());
 
     data->flags = 0;
@@ -164,6 +169,16 @@ JITTimeProfileInfo::GetArrayCallSiteInfoAddr(Js::ProfileId index) const
     return m_profileData.arrayCallSiteDataAddr + index * sizeof(ArrayCallSiteIDL);
 }
 
+bool
+JITTimeProfileInfo::IsAllocationSitePretenured(uint siteIndex) const
+{
+    if (siteIndex >= m_profileData.allocationSiteCount)
+    {
+        return false;
+    }
+    return reinterpret_cast<Js::AllocationSiteInfo*>(m_profileData.allocationSiteData)[siteIndex].IsPretenured();
+}
+
 Js::FldInfo *
 JITTimeProfileInfo::GetFldInfo(uint fieldAccessId) const
 {
@@ -22,6 +22,7 @@ public:
 
     Js::ArrayCallSiteInfo * GetArrayCallSiteInfo(Js::ProfileId index) const;
     intptr_t GetArrayCallSiteInfoAddr(Js::ProfileId index) const;
+    bool IsAllocationSitePretenured(uint siteIndex) const;
     Js::FldInfo * GetFldInfo(uint fieldAccessId) const;
     intptr_t GetFldInfoAddr(uint fieldAccessId) const;
     Js::ThisInfo GetThisInfo() const;
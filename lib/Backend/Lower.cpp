@@ -3515,6 +3515,18 @@ Lowerer::LowerNewScObjectLiteral(IR::Instr *newObjInstr)
     literalTypeRefOpnd = IR::AddrOpnd::New(literalTypeRef, IR::AddrOpndKindDynamicMisc, this->m_func);
     propertyArrayOpnd = IR::AddrOpnd::New(propArrayAddr, IR::AddrOpndKindDynamicMisc, this->m_func);
 
+    if (newObjInstr->m_func->HasProfileInfo() &&
+        newObjInstr->m_func->GetReadOnlyProfileInfo()->IsAllocationSitePretenured(literalObjectIdOpnd->AsUint32()))
+    {
+        // Objects from this literal have been surviving collections: allocate them from the recycler's
+        // pretenured blocks instead of inline from the new object allocator.
+        m_lowererMD.LoadHelperArgument(newObjInstr, literalTypeRefOpnd);
+        m_lowererMD.LoadHelperArgument(newObjInstr, propertyArrayOpnd);
+        LoadScriptContext(newObjInstr);
+        m_lowererMD.ChangeToHelperCall(newObjInstr, IR::HelperNewScObjectLiteralPretenured);
+        return;
+    }
+
     //#if 0 TODO: OOP JIT, obj literal types
     // should pass in isShared bit through RPC, enable for in-proc jit to see perf impact
     Js::DynamicType * literalType = func->IsOOPJIT() || !CONFIG_FLAG(OOPJITMissingOpts) ? nullptr : *(Js::DynamicType **)literalTypeRef;
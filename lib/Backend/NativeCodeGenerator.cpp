@@ -522,6 +522,24 @@ NativeCodeGenerator::GenerateFunction(Js::FunctionBody *fn, Js::ScriptFunction *
         return false;
     }
 
+    if (fn->GetLoopCount() != 0 && fn->DoJITLoopBody() && !fn->IsInDebugMode() && fn->GetByteCode() != nullptr &&
+        !IS_PREJIT_ON() && !Js::Configuration::Global.flags.ForceNative &&
+        ExceedsJITByteCodeLimits(fn->GetByteCode()->GetLength(), fn->GetByteCodeCount() + fn->GetConstantCount()))
+    {
+        // The function is too large to JIT as a whole, which would fail in the background every time it's queued. Leave it
+        // in the interpreter and let its hot loops be JIT'ed as regions of their own.
+        if (PHASE_TRACE(Js::JITLoopBodyPhase, fn))
+        {
+            char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+            Output::Print(
+                _u("Function exceeds JIT limits, only JIT'ing its loops: function: %s (%s)\n"),
+                fn->GetDisplayName(),
+                fn->GetDebugNumberSet(debugStringBuffer));
+            Output::Flush();
+        }
+        return false;
+    }
+
     // Create a work item with null entry point- we'll set it once its allocated
     AutoPtr<JsFunctionCodeGen> workItemAutoPtr(this->NewFunctionCodeGen(fn, nullptr));
     if ((JsFunctionCodeGen*) workItemAutoPtr == nullptr)
@@ -1199,6 +1217,9 @@ NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* wor
 #endif
 }
 
+static const char16 *const JitQueuePriorityNames[] = { _u("Low"), _u("Normal"), _u("High") };
+CompileAssert(_countof(JitQueuePriorityNames) == static_cast<size_t>(JsUtil::JobPriority::Count));
+
 /* static */
 void NativeCodeGenerator::LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTEGER * start_time)
 {
@@ -1231,6 +1252,19 @@ void NativeCodeGenerator::LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTE
         }
     }
 
+    // Time the work item spent in the jit queue before a thread picked it up
+    LARGE_INTEGER dequeued_time;
+    QueryPerformanceCounter(&dequeued_time);
+    const int64 queueWaitTime = dequeued_time.QuadPart - workItem->GetQueuedTime();
+    const uint priority = static_cast<uint>(workItem->Priority());
+
+#ifdef BGJIT_STATS
+    // Must be interlocked because work items of the same script context may be processed by several threads concurrently
+    Js::ScriptContext *scriptContext = workItem->GetScriptContext();
+    InterlockedIncrement(&scriptContext->jitQueueWaitCount[priority]);
+    InterlockedExchangeAdd64((volatile LONG64 *)&scriptContext->jitQueueWaitTime[priority], queueWaitTime);
+#endif
+
 #if DBG_DUMP
     if (Js::Configuration::Global.flags.TestTrace.IsEnabled(Js::BackEndPhase))
     {
@@ -1250,16 +1284,20 @@ void NativeCodeGenerator::LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTE
 
     if (PHASE_TRACE(Js::BackEndPhase, body))
     {
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
         QueryPerformanceCounter(start_time);
         if (workItem->GetEntryPoint()->IsLoopBody())
         {
             Output::Print(
-                _u("BeginBackEnd - function: %s (%s, line %u), loop: %u, mode: %S"),
+                _u("BeginBackEnd - function: %s (%s, line %u), loop: %u, mode: %S, priority: %s, queue wait:%8.6f mSec"),
                 body->GetDisplayName(),
                 body->GetDebugNumberSet(debugStringBuffer),
                 body->GetLineNumber(),
                 ((JsLoopBodyCodeGen*)workItem)->GetLoopNumber(),
-                ExecutionModeName(workItem->GetJitMode()));
+                ExecutionModeName(workItem->GetJitMode()),
+                JitQueuePriorityNames[priority],
+                queueWaitTime * 1000.0 / freq.QuadPart);
             if (body->GetIsAsmjsMode())
             {
                 Output::Print(_u(" (Asmjs)\n"));
@@ -1272,11 +1310,13 @@ void NativeCodeGenerator::LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTE
         else
         {
             Output::Print(
-                _u("BeginBackEnd - function: %s (%s, line %u), mode: %S"),
+                _u("BeginBackEnd - function: %s (%s, line %u), mode: %S, priority: %s, queue wait:%8.6f mSec"),
                 body->GetDisplayName(),
                 body->GetDebugNumberSet(debugStringBuffer),
                 body->GetLineNumber(),
-                ExecutionModeName(workItem->GetJitMode()));
+                ExecutionModeName(workItem->GetJitMode()),
+                JitQueuePriorityNames[priority],
+                queueWaitTime * 1000.0 / freq.QuadPart);
 
             if (body->GetIsAsmjsMode())
             {
@@ -1670,6 +1710,12 @@ NativeCodeGenerator::CheckCodeGenDone(
             entryPointInfo->GetNativeEntrypoint());
         jsMethod = entryPointInfo->jsMethod;
 
+        JitWarmupCache *const jitWarmupCache = scriptContext->GetThreadContext()->GetJitWarmupCache();
+        if (jitWarmupCache != nullptr && entryPointInfo->GetJitMode() == ExecutionMode::FullJit && functionBody->GetByteCode() != nullptr)
+        {
+            jitWarmupCache->AddFullJitFunction(functionBody->GetByteCode());
+        }
+
         Assert(!functionBody->NeedEnsureDynamicProfileInfo() || jsMethod == Js::DynamicProfileInfo::EnsureDynamicProfileInfoThunk || functionBody->GetIsAsmjsMode());
         if (functionBody->GetIsAsmjsMode() && functionBody->NeedEnsureDynamicProfileInfo())
         {
@@ -1777,7 +1823,8 @@ NativeCodeGenerator::AfterWaitForJob(Js::EntryPointInfo *const entryPoint) const
 * (currently 7 MB) of code on this thread or MaxProcessJITCodeHeapSize (currently 55 MB)
 * in the process. In real world websites we rarely (if at all) hit this limit.
 * Also, if this workitem's byte code size is in excess of MaxJITFunctionBytecodeSize instructions,
-* it exceeds the JIT limits
+* it exceeds the JIT limits. For a loop body only the byte code of the loop counts, so the hot loops
+* of a function that is too large to JIT can still be JIT'ed one region at a time.
 */
 bool
 NativeCodeGenerator::WorkItemExceedsJITLimits(CodeGenWorkItem *const codeGenWork)
@@ -1785,8 +1832,15 @@ NativeCodeGenerator::WorkItemExceedsJITLimits(CodeGenWorkItem *const codeGenWork
     return
         (codeGenWork->GetScriptContext()->GetThreadContext()->GetCodeSize() >= Js::Constants::MaxThreadJITCodeHeapSize) ||
         (ThreadContext::GetProcessCodeSize() >= Js::Constants::MaxProcessJITCodeHeapSize) ||
-        (codeGenWork->GetByteCodeLength() >= (uint)CONFIG_FLAG(MaxJITFunctionBytecodeByteLength)) ||
-        (codeGenWork->GetByteCodeCount() >= (uint)CONFIG_FLAG(MaxJITFunctionBytecodeCount));
+        ExceedsJITByteCodeLimits(codeGenWork->GetByteCodeLength(), codeGenWork->GetByteCodeCount());
+}
+
+bool
+NativeCodeGenerator::ExceedsJITByteCodeLimits(const uint byteCodeLength, const uint byteCodeCount)
+{
+    return
+        byteCodeLength >= (uint)CONFIG_FLAG(MaxJITFunctionBytecodeByteLength) ||
+        byteCodeCount >= (uint)CONFIG_FLAG(MaxJITFunctionBytecodeCount);
 }
 bool
 NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData)
@@ -2040,6 +2094,19 @@ NativeCodeGenerator::JobProcessed(JsUtil::Job *const job, const bool succeeded)
             uint loopNum = loopBodyCodeGen->GetJITData()->loopNumber;
             functionBody->SetLoopBodyEntryPoint(loopBodyCodeGen->loopHeader, entryPoint, (Js::JavascriptMethod)loopBodyCodeGen->GetCodeAddress(), loopNum);
             entryPoint->SetCodeGenDone();
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+            if (PHASE_TRACE(Js::JITLoopBodyPhase, functionBody))
+            {
+                char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+                Output::Print(
+                    _u("Loop body JIT'ed: function: %s (%s), loop: %u\n"),
+                    functionBody->GetDisplayName(),
+                    functionBody->GetDebugNumberSet(debugStringBuffer),
+                    loopNum);
+                Output::Flush();
+            }
+#endif
         }
         else
         {
@@ -3409,6 +3476,7 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
             workItemRemoved->OnRemoveFromJitQueue(this);
         }
     }
+    codeGenWorkItem->SetPriority(GetJitQueuePriority(codeGenWorkItem));
     Processor()->AddJob(codeGenWorkItem, prioritize);   // This one can throw (really unlikely though), OOM specifically.
     if(jitMode == ExecutionMode::FullJit)
     {
@@ -3429,6 +3497,24 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
     codeGenWorkItem->OnAddToJitQueue();
 }
 
+/*
+* Work items are queued in three priority classes, which the job processor's threads take from in order:
+* - Loop bodies, since the interpreter is already running the loop and only leaves it once the loop body is JIT'ed
+* - Functions smaller than JitQueueLargeFunctionByteCodeCount, which are cheap to JIT and are hot enough to be queued
+* - Large functions, which would hold a JIT thread long enough to delay many smaller work items queued after them
+*/
+JsUtil::JobPriority NativeCodeGenerator::GetJitQueuePriority(CodeGenWorkItem *const codeGenWorkItem)
+{
+    if (codeGenWorkItem->Type() == JsLoopBodyWorkItemType)
+    {
+        return JsUtil::JobPriority::High;
+    }
+
+    return codeGenWorkItem->GetByteCodeCount() < (uint)CONFIG_FLAG(JitQueueLargeFunctionByteCodeCount)
+        ? JsUtil::JobPriority::Normal
+        : JsUtil::JobPriority::Low;
+}
+
 void NativeCodeGenerator::AddWorkItem(CodeGenWorkItem* workitem)
 {
     workitem->ResetJitMode();
@@ -73,10 +73,12 @@ private:
     void BeforeWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     void AfterWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     static bool WorkItemExceedsJITLimits(CodeGenWorkItem *const codeGenWork);
+    static bool ExceedsJITByteCodeLimits(const uint byteCodeLength, const uint byteCodeCount);
     virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override;
     virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
     JsUtil::Job *GetJobToProcessProactively();
     void AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function = nullptr);
+    static JsUtil::JobPriority GetJitQueuePriority(CodeGenWorkItem *const codeGenWorkItem);
     void RemoveProactiveJobs();
     void UpdateJITState();
     static void LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTEGER * start_time);
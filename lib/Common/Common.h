@@ -124,6 +124,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 #include "Core/ProfileInstrument.h"
 #include "Core/ProfileMemory.h"
 #include "Core/StackBackTrace.h"
+#include "Core/JsonStreamWriter.h"
 
 #include "Common/Event.h"
 #include "Common/Jobs.h"
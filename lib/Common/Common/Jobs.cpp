@@ -34,14 +34,14 @@ namespace JsUtil
     // Job
     // -------------------------------------------------------------------------------------------------------------------------
 
-    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical)
+    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical), priority(JobPriority::Normal), queuedPriority(JobPriority::Normal)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
     {
     }
 
-    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical)
+    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical), priority(JobPriority::Normal), queuedPriority(JobPriority::Normal)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
@@ -59,6 +59,98 @@ namespace JsUtil
         return isCritical;
     }
 
+    JobPriority Job::Priority() const
+    {
+        return priority;
+    }
+
+    void Job::SetPriority(const JobPriority priority)
+    {
+        Assert(priority < JobPriority::Count);
+        this->priority = priority;
+    }
+
+    // -------------------------------------------------------------------------------------------------------------------------
+    // JobQueue
+    // -------------------------------------------------------------------------------------------------------------------------
+
+    Job *JobQueue::Head() const
+    {
+        for (uint i = ListCount; i != 0; --i)
+        {
+            Job *const job = lists[i - 1].Head();
+            if (job)
+                return job;
+        }
+        return 0;
+    }
+
+    bool JobQueue::Contains(Job *const job) const
+    {
+        Assert(job);
+        return lists[static_cast<uint>(job->queuedPriority)].Contains(job);
+    }
+
+    DoublyLinkedList<Job> &JobQueue::GetList(const uint index)
+    {
+        Assert(index < ListCount);
+        return lists[index];
+    }
+
+    Job *JobQueue::FindFirstJobOfManager(JobManager *const manager) const
+    {
+        Assert(manager);
+
+        for (uint i = ListCount; i != 0; --i)
+        {
+            for (Job *job = lists[i - 1].Head(); job; job = job->Next())
+            {
+                if (job->Manager() == manager)
+                    return job;
+            }
+        }
+        return 0;
+    }
+
+    void JobQueue::Link(Job *const job, const bool prioritize)
+    {
+        Assert(job);
+
+        job->queuedPriority = job->Priority();
+        DoublyLinkedList<Job> &list = lists[static_cast<uint>(job->queuedPriority)];
+        if (prioritize)
+            list.LinkToBeginning(job);
+        else
+            list.LinkToEnd(job);
+    }
+
+    void JobQueue::Unlink(Job *const job)
+    {
+        Assert(job);
+        lists[static_cast<uint>(job->queuedPriority)].Unlink(job);
+    }
+
+    Job *JobQueue::UnlinkFromBeginning()
+    {
+        Job *const job = Head();
+        if (job)
+            Unlink(job);
+        return job;
+    }
+
+    void JobQueue::MoveToBeginning(Job *const job)
+    {
+        Unlink(job);
+        job->queuedPriority = static_cast<JobPriority>(ListCount - 1);
+        lists[ListCount - 1].LinkToBeginning(job);
+    }
+
+    void JobQueue::Clear()
+    {
+        for (uint i = 0; i < ListCount; ++i)
+            lists[i].Clear();
+    }
+
     // -------------------------------------------------------------------------------------------------------------------------
     // JobManager
     // -------------------------------------------------------------------------------------------------------------------------
@@ -270,32 +362,36 @@ namespace JsUtil
             return;
         }
 
-        // Move this manager's jobs to the beginning too. Find sequences of this manager's jobs backwards so that their relative
-        // order remains intact after the sequences are moved.
-        Job *const originalHead = jobs.Head();
-        Job *lastJob = 0;
-        for (Job *job = jobs.Tail(); job; job = job->Previous())
+        // Move this manager's jobs to the beginning of their lists too. Find sequences of this manager's jobs backwards so that
+        // their relative order remains intact after the sequences are moved.
+        for (uint i = 0; i < JobQueue::ListCount; ++i)
         {
-            if (job->Manager() == manager)
-            {
-                if (!lastJob)
-                    lastJob = job;
-            }
-            else if (lastJob)
+            DoublyLinkedList<Job> &list = jobs.GetList(i);
+            Job *const originalHead = list.Head();
+            Job *lastJob = 0;
+            for (Job *job = list.Tail(); job; job = job->Previous())
             {
-                jobs.MoveSubsequenceToBeginning(job->Next(), lastJob);
-                lastJob = 0;
-            }
+                if (job->Manager() == manager)
+                {
+                    if (!lastJob)
+                        lastJob = job;
+                }
+                else if (lastJob)
+                {
+                    list.MoveSubsequenceToBeginning(job->Next(), lastJob);
+                    lastJob = 0;
+                }
 
-            if (job == originalHead)
+                if (job == originalHead)
+                {
+                    break;
+                }
+            }
+            if (lastJob)
             {
-                break;
+                list.MoveSubsequenceToBeginning(originalHead, lastJob);
             }
         }
-        if (lastJob)
-        {
-            jobs.MoveSubsequenceToBeginning(originalHead, lastJob);
-        }
     }
 
     void JobProcessor::AddJob(Job *const job, const bool prioritize)
@@ -310,10 +406,8 @@ namespace JsUtil
             Js::Throw::OutOfMemory();  // Overflow: job counts we use are int32's.
         ++job->Manager()->numJobsAddedToProcessor;
 
-        if (prioritize)
-            jobs.LinkToBeginning(job);
-        else
-            jobs.LinkToEnd(job);
+        // A prioritized job goes ahead of the queued jobs of the same priority, otherwise it goes after them
+        jobs.Link(job, prioritize);
     }
 
     bool JobProcessor::RemoveJob(Job *const job)
@@ -377,17 +471,35 @@ namespace JsUtil
             return;
 
         // Remove this manager's jobs from the queue
-        Job *firstJob = 0;
-        for (Job *job = jobs.Head(); job; job = job->Next())
+        for (uint i = 0; i < JobQueue::ListCount; ++i)
         {
-            if (job->Manager() == manager)
+            DoublyLinkedList<Job> &list = jobs.GetList(i);
+            Job *firstJob = 0;
+            for (Job *job = list.Head(); job; job = job->Next())
             {
-                if (!firstJob)
-                    firstJob = job;
+                if (job->Manager() == manager)
+                {
+                    if (!firstJob)
+                        firstJob = job;
+                }
+                else if (firstJob)
+                {
+                    list.UnlinkSubsequence(firstJob, job->Previous());
+                    for (Job *removedJob = firstJob; removedJob;)
+                    {
+                        Job *const next = removedJob->Next();
+                        Assert(!removedJob->IsCritical());
+                        JobProcessed(manager, removedJob, false); // the job may be deleted during this and should not be used afterwards
+                        Assert(manager->numJobsAddedToProcessor != 0);
+                        --manager->numJobsAddedToProcessor;
+                        removedJob = next;
+                    }
+                    firstJob = 0;
+                }
             }
-            else if (firstJob)
+            if (firstJob)
             {
-                jobs.UnlinkSubsequence(firstJob, job->Previous());
+                list.UnlinkSubsequenceFromEnd(firstJob);
                 for (Job *removedJob = firstJob; removedJob;)
                 {
                     Job *const next = removedJob->Next();
@@ -397,20 +509,6 @@ namespace JsUtil
                     --manager->numJobsAddedToProcessor;
                     removedJob = next;
                 }
-                firstJob = 0;
-            }
-        }
-        if (firstJob)
-        {
-            jobs.UnlinkSubsequenceFromEnd(firstJob);
-            for (Job *removedJob = firstJob; removedJob;)
-            {
-                Job *const next = removedJob->Next();
-                Assert(!removedJob->IsCritical());
-                JobProcessed(manager, removedJob, false); // the job may be deleted during this and should not be used afterwards
-                Assert(manager->numJobsAddedToProcessor != 0);
-                --manager->numJobsAddedToProcessor;
-                removedJob = next;
             }
         }
 
@@ -447,19 +545,22 @@ namespace JsUtil
         if (IsClosed())
             return;
 
-        for (Job *job = jobs.Head(); job;)
+        for (uint i = JobQueue::ListCount; i != 0; --i)
         {
-            Job *const next = job->Next();
-            JobManager *const manager = job->Manager();
-            JobProcessed(
-                manager,
-                job,
-                job->IsCritical() ? Process(job) : false); // the job may be deleted during this and should not be used afterwards
-            Assert(manager->numJobsAddedToProcessor != 0);
-            --manager->numJobsAddedToProcessor;
-            if (manager->numJobsAddedToProcessor == 0)
-                LastJobProcessed(manager); // the manager may be deleted during this and should not be used afterwards
-            job = next;
+            for (Job *job = jobs.GetList(i - 1).Head(); job;)
+            {
+                Job *const next = job->Next();
+                JobManager *const manager = job->Manager();
+                JobProcessed(
+                    manager,
+                    job,
+                    job->IsCritical() ? Process(job) : false); // the job may be deleted during this and should not be used afterwards
+                Assert(manager->numJobsAddedToProcessor != 0);
+                --manager->numJobsAddedToProcessor;
+                if (manager->numJobsAddedToProcessor == 0)
+                    LastJobProcessed(manager); // the manager may be deleted during this and should not be used afterwards
+                job = next;
+            }
         }
         jobs.Clear();
 
@@ -849,17 +950,46 @@ namespace JsUtil
             }
 
             // Remove this manager's jobs from the queue
-            Job *firstJob = 0;
-            for(Job *job = jobs.Head(); job; job = job->Next())
+            for(uint i = 0; i < JobQueue::ListCount; ++i)
             {
-                if(job->Manager() == manager)
+                DoublyLinkedList<Job> &list = jobs.GetList(i);
+                Job *firstJob = 0;
+                for(Job *job = list.Head(); job; job = job->Next())
                 {
-                    if(!firstJob)
-                        firstJob = job;
+                    if(job->Manager() == manager)
+                    {
+                        if(!firstJob)
+                            firstJob = job;
+                    }
+                    else if(firstJob)
+                    {
+                        list.UnlinkSubsequence(firstJob, job->Previous());
+                        for(Job *removedJob = firstJob; removedJob;)
+                        {
+                            Job *const next = removedJob->Next();
+                            Assert(!removedJob->IsCritical());
+                            Assert(numJobs != 0);
+                            --numJobs;
+                            JobProcessed(manager, removedJob, false); // the job may be deleted during this and should not be used afterwards
+                            Assert(manager->numJobsAddedToProcessor != 0);
+                            --manager->numJobsAddedToProcessor;
+                            if(manager->isWaitable)
+                            {
+                                WaitableJobManager *const waitableManager = static_cast<WaitableJobManager *>(manager);
+                                if(waitableManager->jobBeingWaitedUpon == removedJob)
+                                {
+                                    waitableManager->jobBeingWaitedUponProcessed.Set();
+                                    waitableManager->jobBeingWaitedUpon = 0;
+                                }
+                            }
+                            removedJob = next;
+                        }
+                        firstJob = 0;
+                    }
                 }
-                else if(firstJob)
+                if(firstJob)
                 {
-                    jobs.UnlinkSubsequence(firstJob, job->Previous());
+                    list.UnlinkSubsequenceFromEnd(firstJob);
                     for(Job *removedJob = firstJob; removedJob;)
                     {
                         Job *const next = removedJob->Next();
@@ -880,31 +1010,6 @@ namespace JsUtil
                         }
                         removedJob = next;
                     }
-                    firstJob = 0;
-                }
-            }
-            if(firstJob)
-            {
-                jobs.UnlinkSubsequenceFromEnd(firstJob);
-                for(Job *removedJob = firstJob; removedJob;)
-                {
-                    Job *const next = removedJob->Next();
-                    Assert(!removedJob->IsCritical());
-                    Assert(numJobs != 0);
-                    --numJobs;
-                    JobProcessed(manager, removedJob, false); // the job may be deleted during this and should not be used afterwards
-                    Assert(manager->numJobsAddedToProcessor != 0);
-                    --manager->numJobsAddedToProcessor;
-                    if(manager->isWaitable)
-                    {
-                        WaitableJobManager *const waitableManager = static_cast<WaitableJobManager *>(manager);
-                        if(waitableManager->jobBeingWaitedUpon == removedJob)
-                        {
-                            waitableManager->jobBeingWaitedUponProcessed.Set();
-                            waitableManager->jobBeingWaitedUpon = 0;
-                        }
-                    }
-                    removedJob = next;
                 }
             }
 
@@ -1124,38 +1229,41 @@ namespace JsUtil
             if(IsClosed())
                 return;
 
-            Job *nextJob = jobs.Head();
-            while(nextJob)
+            for(uint i = JobQueue::ListCount; i != 0; --i)
             {
-                Job *const job = nextJob;
-                nextJob = job->Next();
-                if(job->IsCritical())
+                Job *nextJob = jobs.GetList(i - 1).Head();
+                while(nextJob)
                 {
-                    // Critical jobs need to be left in the queue. After this instance is flagged as closed, the background
-                    // thread will continue processing critical jobs, for which this function will wait before returning.
-                    continue;
-                }
+                    Job *const job = nextJob;
+                    nextJob = job->Next();
+                    if(job->IsCritical())
+                    {
+                        // Critical jobs need to be left in the queue. After this instance is flagged as closed, the background
+                        // thread will continue processing critical jobs, for which this function will wait before returning.
+                        continue;
+                    }
 
-                jobs.Unlink(job);
-                Assert(numJobs != 0);
-                --numJobs;
-                JobManager *const manager = job->Manager();
-                JobProcessed(manager, job, false); // the job may be deleted during this and should not be used afterwards
-                Assert(manager->numJobsAddedToProcessor != 0);
-                --manager->numJobsAddedToProcessor;
-                if(manager->isWaitable)
-                {
-                    WaitableJobManager *const waitableManager = static_cast<WaitableJobManager *>(manager);
-                    if(waitableManager->jobBeingWaitedUpon == job)
+                    jobs.Unlink(job);
+                    Assert(numJobs != 0);
+                    --numJobs;
+                    JobManager *const manager = job->Manager();
+                    JobProcessed(manager, job, false); // the job may be deleted during this and should not be used afterwards
+                    Assert(manager->numJobsAddedToProcessor != 0);
+                    --manager->numJobsAddedToProcessor;
+                    if(manager->isWaitable)
                     {
-                        waitableManager->jobBeingWaitedUponProcessed.Set();
-                        waitableManager->jobBeingWaitedUpon = 0;
+                        WaitableJobManager *const waitableManager = static_cast<WaitableJobManager *>(manager);
+                        if(waitableManager->jobBeingWaitedUpon == job)
+                        {
+                            waitableManager->jobBeingWaitedUponProcessed.Set();
+                            waitableManager->jobBeingWaitedUpon = 0;
+                        }
+                    }
+                    if(manager->numJobsAddedToProcessor == 0)
+                    {
+                        Assert(!GetCurrentJobOfManager(manager));
+                        LastJobProcessed(manager); // the manager may be deleted during this and should not be used afterwards
                     }
-                }
-                if(manager->numJobsAddedToProcessor == 0)
-                {
-                    Assert(!GetCurrentJobOfManager(manager));
-                    LastJobProcessed(manager); // the manager may be deleted during this and should not be used afterwards
                 }
             }
 
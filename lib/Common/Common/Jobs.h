@@ -17,6 +17,7 @@ namespace JsUtil
     class WaitableJobManager;
     class SingleJobManager;
     class WaitableSingleJobManager;
+    class JobQueue;
     class JobProcessor;
     class ForegroundJobProcessor;
 #if ENABLE_BACKGROUND_JOB_PROCESSOR
@@ -24,6 +25,16 @@ namespace JsUtil
 #endif
     struct ParallelThreadData;
 
+    // Job processors process queued jobs in order of priority, and in queue order among jobs of the same priority
+    enum class JobPriority : uint8
+    {
+        Low,
+        Normal,
+        High,
+
+        Count
+    };
+
     // -------------------------------------------------------------------------------------------------------------------------
     // Job
     //
@@ -34,6 +45,7 @@ namespace JsUtil
     {
         friend SingleJobManager;
         friend WaitableSingleJobManager;
+        friend JobQueue;
 
     private:
         JobManager *manager;
@@ -44,6 +56,13 @@ namespace JsUtil
         // JobManager::JobProcessed(succeeded = false).
         const bool isCritical;
 
+        // Only used to order the job in the job processor's queue, and may only be changed while the job is not queued
+        JobPriority priority;
+
+        // The priority of the job processor's list the job is queued in. A job that is waited upon is moved to the list of the
+        // highest priority, regardless of its own priority.
+        JobPriority queuedPriority;
+
     private:
         Job(const bool isCritical = false);
     public:
@@ -65,6 +84,8 @@ namespace JsUtil
     public:
         JobManager *Manager() const;
         bool IsCritical() const;
+        JobPriority Priority() const;
+        void SetPriority(const JobPriority priority);
     };
 
     // -------------------------------------------------------------------------------------------------------------------------
@@ -280,6 +301,40 @@ namespace JsUtil
         bool WasAddedToJobProcessor(JsUtil::Job *const job) const;
     };
 
+    // -------------------------------------------------------------------------------------------------------------------------
+    // JobQueue
+    //
+    // The queue of a job processor. Jobs are kept in one list per priority, so queueing a job doesn't search the queue, and
+    // jobs are taken from the list of the highest priority first.
+    // -------------------------------------------------------------------------------------------------------------------------
+
+    class JobQueue
+    {
+    public:
+        static const uint ListCount = static_cast<uint>(JobPriority::Count);
+
+    private:
+        DoublyLinkedList<Job> lists[ListCount];
+
+    public:
+        // The first job that would be taken from the queue
+        Job *Head() const;
+        bool Contains(Job *const job) const;
+
+        // Lists are indexed by priority, the list of the highest priority is the last one
+        DoublyLinkedList<Job> &GetList(const uint index);
+        Job *FindFirstJobOfManager(JobManager *const manager) const;
+
+    public:
+        // Queues a job at the end of the list of its priority, or at the beginning if it is prioritized
+        void Link(Job *const job, const bool prioritize);
+        void Unlink(Job *const job);
+        Job *UnlinkFromBeginning();
+        // Moves a job that is waited upon to the beginning of the queue
+        void MoveToBeginning(Job *const job);
+        void Clear();
+    };
+
     // -------------------------------------------------------------------------------------------------------------------------
     // JobProcessor
     //
@@ -292,7 +347,7 @@ namespace JsUtil
         bool processesInBackground;
     protected:
         DoublyLinkedList<JobManager> managers;
-        DoublyLinkedList<Job> jobs;
+        JobQueue jobs;
     private:
         bool isClosed;
 
@@ -321,7 +376,7 @@ namespace JsUtil
         template<class Fn> void ForEachManager(Fn fn);
 
         // Prioritizes a job manager, and optionally processes its jobs for a certain amount of time. When a job manager is
-        // prioritized, its jobs are moved to the front of the queue. If the queue depletes of this job manager's jobs, the job
+        // prioritized, its jobs are moved to the front of the lists of their priorities. If the queue depletes of this job manager's jobs, the job
         // processor will call JobManager::GetJobToProcessProactively to proactively process jobs that have not yet been queued,
         // until the time limit. See comments in JobManager for details on why templates are used.
         void PrioritizeManager(JobManager *const manager);
@@ -329,8 +384,8 @@ namespace JsUtil
             TJobManager *const manager,
             const unsigned int milliseconds = INFINITE);
 
-        // Add a job to the queue, and optionally put it in front of the queue. Must be called from inside the lock. A job
-        // manager should use JobManager::AcquireLock and JobManager::ReleaseLock for this purpose.
+        // Add a job to the queue, and optionally put it in front of the jobs of its priority. Must be called from inside the
+        // lock. A job manager should use JobManager::AcquireLock and JobManager::ReleaseLock for this purpose.
         virtual void AddJob(Job *const job, const bool prioritize = false);
 
         // Must be called from inside the lock
@@ -125,8 +125,7 @@ namespace JsUtil
             if(manager->numJobsAddedToProcessor != 0)
             {
                 // Process only jobs from this manager
-                Job *job = jobs.Head();
-                for(; job && job->Manager() != manager; job = job->Next());
+                Job *job = jobs.FindFirstJobOfManager(manager);
                 if(job)
                 {
                     jobs.Unlink(job);
@@ -284,8 +283,7 @@ namespace JsUtil
             {
                 AutoCriticalSection lock(&criticalSection);
                 // Process only jobs from this manager
-                job = jobs.Head();
-                for(; job && job->Manager() != manager; job = job->Next());
+                job = jobs.FindFirstJobOfManager(manager);
                 if(job)
                 {
                     jobs.Unlink(job);
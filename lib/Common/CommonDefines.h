@@ -158,6 +158,9 @@
 #ifndef CHAKRACORE_LITE
 #define IDLE_DECOMMIT_ENABLED 1                     // Idle Decommit
 #endif
+#if !defined(_WIN32) && defined(TARGET_64)
+#define ENABLE_HUGE_PAGE_SEGMENTS 1                 // 2MB recycler segments backed by transparent huge pages
+#endif
 
 #if defined(NTBUILD) || defined(ENABLE_DEBUG_CONFIG_OPTIONS)
 #define RECYCLER_PAGE_HEAP                          // PageHeap support, on by default, off in ChakraCore release build
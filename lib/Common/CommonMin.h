@@ -84,6 +84,7 @@ using namespace Memory;
 // === Page/Arena Memory Header Files ===
 #include "Memory/SectionAllocWrapper.h"
 #include "Memory/VirtualAllocWrapper.h"
+#include "Memory/PageSegmentCache.h"
 #include "Memory/MemoryTracking.h"
 #include "Memory/AllocationPolicyManager.h"
 #include "Memory/PageAllocator.h"
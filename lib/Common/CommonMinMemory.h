@@ -14,6 +14,7 @@ class FinalizableObject;
 #include "Memory/RecyclerPageAllocator.h"
 #include "Memory/FreeObject.h"
 #include "Memory/PagePool.h"
+#include "Memory/WorkStealingDeque.h"
 
 #include "DataStructures/SimpleHashTable.h"
 #include "DataStructures/PageStack.h"
@@ -37,6 +38,8 @@ class FinalizableObject;
 #include "Memory/HeapBlockMap.h"
 #include "Memory/RecyclerObjectDumper.h"
 #include "Memory/RecyclerWeakReference.h"
+#include "Memory/RecyclerEphemeronTable.h"
+#include "Memory/RecyclerBackgroundFinalizeQueue.h"
 #include "Memory/RecyclerSweep.h"
 #include "Memory/RecyclerHeuristic.h"
 #include "Memory/MarkContext.h"
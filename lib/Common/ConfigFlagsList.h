@@ -274,6 +274,7 @@ PHASE(All)
                 PHASE(BackgroundFinishMark)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
+            PHASE(Pretenure)
             PHASE(PartialCollect)
                 PHASE(ResetMarks)
                 PHASE(ResetWriteWatch)
@@ -613,6 +614,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxJITFunctionBytecodeCount (120000)
 
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
+#define DEFAULT_CONFIG_JitQueueLargeFunctionByteCodeCount (1000)    // Functions at least this large are queued for JIT behind loop bodies and smaller functions
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
 
@@ -637,6 +639,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_MinProfileIterations (16)
 #define DEFAULT_CONFIG_MinProfileIterations_OldSimpleJit (25)
 #define DEFAULT_CONFIG_MinSimpleJitIterations (16)
+#define DEFAULT_CONFIG_JitWarmupFullJitThreshold (16)
+#define DEFAULT_CONFIG_PersistedProfileFullJitThreshold (4)
 #define DEFAULT_CONFIG_NewSimpleJit (false)
 
 #define DEFAULT_CONFIG_MaxLinearIntCaseCount     (3)       // Maximum number of cases (in switch statement) for which instructions can be generated linearly.
@@ -720,6 +724,8 @@ PHASE(All)
 #endif
 
 #define DEFAULT_CONFIG_RecyclerForceMarkInterior (false)
+#define DEFAULT_CONFIG_RecyclerMaxParallelism (0)     // 0 means one thread per physical processor
+#define DEFAULT_CONFIG_RecyclerParallelSweep (true)
 
 #define DEFAULT_CONFIG_MemProtectHeap (false)
 
@@ -746,6 +752,26 @@ PHASE(All)
 #define DEFAULT_CONFIG_StrictWriteBarrierCheck  (false)
 #define DEFAULT_CONFIG_KeepRecyclerTrackData  (false)
 #define DEFAULT_CONFIG_EnableBGFreeZero (true)
+#define DEFAULT_CONFIG_PageSegmentCacheMaxSize (8192) // In KB
+#define DEFAULT_CONFIG_LeafBlockDensityOrdering (false)
+#define DEFAULT_CONFIG_GCPauseBudget (0) // In milliseconds
+#define DEFAULT_CONFIG_RecyclerSizeHistogram (false)
+#define DEFAULT_CONFIG_RecyclerAllocationSampleInterval (0) // In KB
+// Pretenured heap blocks don't reuse the slots of their dead objects. A block goes back to the normal
+// allocators once a sweep finds fewer than SmallHeapBlockT::PretenuredBlockMinLivePercent (25%) of its
+// objects alive, which bounds what a pretenured site whose objects do die keeps committed.
+#define DEFAULT_CONFIG_RecyclerPretenure (false)
+#define DEFAULT_CONFIG_PretenureSampleInterval (32)
+#define DEFAULT_CONFIG_PretenureSurvivalPercent (90)
+#define DEFAULT_CONFIG_ConcurrentWeakReferenceSweep (true)
+#define DEFAULT_CONFIG_RecyclerBackgroundFinalize (false)
+#define DEFAULT_CONFIG_ArenaBlockCacheMaxSize (256) // In KB
+#define DEFAULT_CONFIG_RecyclerDedicatedLargeObjectSize (256 * 1024)
+#ifdef _WIN32
+#define DEFAULT_CONFIG_LazyDecommit (false)
+#else
+#define DEFAULT_CONFIG_LazyDecommit (true)
+#endif
 
 #if !GLOBAL_ENABLE_WRITE_BARRIER
 #define DEFAULT_CONFIG_ForceSoftwareWriteBarrier  (false)
@@ -1169,6 +1195,7 @@ FLAGNR(Number,  AsmJsInlineAdjust       , "Adjustment in the maximum size in byt
 FLAGNR(String,  Interpret             , "List of functions to interpret", nullptr)
 FLAGNR(Phases,  Instrument            , "Instrument the generated code from the given phase", )
 FLAGNR(Number,  JitQueueThreshold     , "Max number of work items/script context in the jit queue", DEFAULT_CONFIG_JitQueueThreshold)
+FLAGNR(Number,  JitQueueLargeFunctionByteCodeCount, "Functions with at least this many byte code instructions are queued for JIT behind loop bodies and smaller functions", DEFAULT_CONFIG_JitQueueLargeFunctionByteCodeCount)
 #ifdef LEAK_REPORT
 FLAGNR(String,  LeakReport            , "File name for the leak report", nullptr)
 #endif
@@ -1227,6 +1254,8 @@ FLAGR (Number,  ProfilingInterpreter0Limit, "Limit after which to transition to
 FLAGR (Number,  AutoProfilingInterpreter1Limit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_AutoProfilingInterpreter1Limit)
 FLAGR (Number,  SimpleJitLimit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_SimpleJitLimit)
 FLAGR (Number,  ProfilingInterpreter1Limit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_ProfilingInterpreter1Limit)
+FLAGR (Number,  JitWarmupFullJitThreshold, "Full JIT threshold of functions found in a loaded JIT warm-up cache", DEFAULT_CONFIG_JitWarmupFullJitThreshold)
+FLAGR (Number,  PersistedProfileFullJitThreshold, "Full JIT threshold of functions that get a well-profiled dynamic profile from a loaded profile cache", DEFAULT_CONFIG_PersistedProfileFullJitThreshold)
 
 FLAGNRA(String, ExecutionModeLimits,        Eml,  "Execution mode limits in th form: AutoProfilingInterpreter0.ProfilingInterpreter0.AutoProfilingInterpreter1.SimpleJit.ProfilingInterpreter1 - Example: -ExecutionModeLimits:12.4.0.132.12", _u(""))
 FLAGRA(Boolean, EnforceExecutionModeLimits, Eeml, "Enforces the execution mode limits such that they are never exceeded.", false)
@@ -1338,6 +1367,8 @@ FLAGNR(Boolean, RecyclerInduceFalsePositives, "Stress recycler by forcing false
 #endif // RECYCLER_STRESS
 FLAGNR(Boolean, RecyclerForceMarkInterior, "Force all the mark as interior", DEFAULT_CONFIG_RecyclerForceMarkInterior)
 #if ENABLE_CONCURRENT_GC
+FLAGR (Number,  RecyclerMaxParallelism, "Max number of threads used for parallel mark, including the main thread (0 = one per physical processor)", DEFAULT_CONFIG_RecyclerMaxParallelism)
+FLAGR (Boolean, RecyclerParallelSweep, "Use the parallel mark threads to sweep heap buckets during background sweep", DEFAULT_CONFIG_RecyclerParallelSweep)
 FLAGNR(Number,  RecyclerPriorityBoostTimeout, "Adjust priority boost timeout", 5000)
 FLAGNR(Number,  RecyclerThreadCollectTimeout, "Adjust thread collect timeout", 1000)
 FLAGRA(Boolean, EnableConcurrentSweepAlloc, ecsa, "Turns off the feature to allow allocations during concurrent sweep.", true)
@@ -1539,6 +1570,19 @@ FLAGNR(Boolean, CFG, "Force enable CFG on jshost. version in the jshost's manife
 
 FLAGR(Number, JITServerIdleTimeout, "Idle timeout in milliseconds to do the cleanup in JIT server", 500)
 FLAGR(Number, JITServerMaxInactivePageAllocatorCount, "Max inactive page allocators to keep before schedule a cleanup", 10)
+FLAGR(Number, ArenaBlockCacheMaxSize, "Max size in KB of arena blocks each page allocator keeps for reuse by the next arenas (0 disables the cache)", DEFAULT_CONFIG_ArenaBlockCacheMaxSize)
+FLAGR(Number, PageSegmentCacheMaxSize, "Max size in KB of empty page segments kept for reuse by any page allocator in the process (0 disables the cache)", DEFAULT_CONFIG_PageSegmentCacheMaxSize)
+FLAGR(Boolean, RecyclerSizeHistogram, "Record allocations by size class, and print the histogram when the recycler goes away", DEFAULT_CONFIG_RecyclerSizeHistogram)
+FLAGR(Number, RecyclerAllocationSampleInterval, "Sample the JavaScript stack about once every this many KB allocated from the recycler (0 to disable)", DEFAULT_CONFIG_RecyclerAllocationSampleInterval)
+FLAGR(Boolean, RecyclerPretenure, "Allocate the objects of allocation sites whose objects survive collections into heap blocks of their own", DEFAULT_CONFIG_RecyclerPretenure)
+FLAGR(Number, PretenureSampleInterval, "Check whether one in this many objects allocated at an allocation site survives the next collection", DEFAULT_CONFIG_PretenureSampleInterval)
+FLAGR(Number, PretenureSurvivalPercent, "Pretenure the objects of allocation sites where at least this percentage of the sampled objects survive", DEFAULT_CONFIG_PretenureSurvivalPercent)
+FLAGR(Boolean, ConcurrentWeakReferenceSweep, "Find the weak references that survive a collection during the background finish mark", DEFAULT_CONFIG_ConcurrentWeakReferenceSweep)
+FLAGR(Boolean, RecyclerBackgroundFinalize, "Run thread-agnostic finalizers, like freeing ArrayBuffer memory, in batches on a background thread", DEFAULT_CONFIG_RecyclerBackgroundFinalize)
+FLAGR(Number, RecyclerDedicatedLargeObjectSize, "Large objects of at least this many bytes get a heap block of their own, whose pages are released as soon as the object is swept (0 to disable)", DEFAULT_CONFIG_RecyclerDedicatedLargeObjectSize)
+FLAGR(Number, GCPauseBudget, "Best effort max time in milliseconds the thread waits for a concurrent collection before going back to script (0 for no limit)", DEFAULT_CONFIG_GCPauseBudget)
+FLAGR(Boolean, LeafBlockDensityOrdering, "Allocate from the densest leaf heap blocks first so that sparse ones can drain and be freed", DEFAULT_CONFIG_LeafBlockDensityOrdering)
+FLAGR(Boolean, LazyDecommit, "Decommit page allocator pages with MEM_RESET (madvise on Linux) and keep them mapped instead of decommitting them", DEFAULT_CONFIG_LazyDecommit)
 
 FLAGNR(Boolean, StrictWriteBarrierCheck, "Check write barrier setting on none write barrier pages", DEFAULT_CONFIG_StrictWriteBarrierCheck)
 FLAGNR(Boolean, WriteBarrierTest, "Always return true while checking barrier to test recycler regardless of annotation", DEFAULT_CONFIG_WriteBarrierTest)
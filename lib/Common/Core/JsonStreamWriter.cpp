@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonCorePch.h"
+#include "Core/JsonStreamWriter.h"
+
+JsonStreamWriter::JsonStreamWriter(JsonStreamWriteCallback writeCallback, void * writeContext) :
+    writeCallback(writeCallback),
+    writeContext(writeContext),
+    writeFailed(false),
+    bufferLength(0)
+{
+}
+
+void
+JsonStreamWriter::WriteRaw(char const * string)
+{
+    while (*string != '\0')
+    {
+        WriteChar(*string++);
+    }
+}
+
+void
+JsonStreamWriter::WriteChar(char c)
+{
+    if (bufferLength == BufferSize)
+    {
+        Flush();
+    }
+    buffer[bufferLength++] = c;
+}
+
+void
+JsonStreamWriter::WriteNumber(uint64 number)
+{
+    char digits[20];
+    size_t digitCount = 0;
+    do
+    {
+        digits[digitCount++] = (char)('0' + number % 10);
+        number /= 10;
+    }
+    while (number != 0);
+
+    while (digitCount != 0)
+    {
+        WriteChar(digits[--digitCount]);
+    }
+}
+
+void
+JsonStreamWriter::WriteString(char16 const * string)
+{
+    static char const hexDigits[] = "0123456789abcdef";
+
+    WriteChar('"');
+    for (; string != nullptr && *string != _u('\0'); string++)
+    {
+        char16 c = *string;
+        if (c == _u('"') || c == _u('\\'))
+        {
+            WriteChar('\\');
+            WriteChar((char)c);
+        }
+        else if (c >= 0x20 && c < 0x7F)
+        {
+            WriteChar((char)c);
+        }
+        else
+        {
+            // Escape everything else, surrogate pairs come out as two escapes
+            WriteRaw("\\u");
+            WriteChar(hexDigits[(c >> 12) & 0xF]);
+            WriteChar(hexDigits[(c >> 8) & 0xF]);
+            WriteChar(hexDigits[(c >> 4) & 0xF]);
+            WriteChar(hexDigits[c & 0xF]);
+        }
+    }
+    WriteChar('"');
+}
+
+bool
+JsonStreamWriter::Flush()
+{
+    if (bufferLength != 0 && !writeFailed)
+    {
+        writeFailed = !writeCallback(buffer, bufferLength, writeContext);
+    }
+    bufferLength = 0;
+    return !writeFailed;
+}
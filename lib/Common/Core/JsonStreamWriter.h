@@ -0,0 +1,40 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Returns false if the output couldn't be written, which stops the write
+typedef bool (CALLBACK * JsonStreamWriteCallback)(char const * buffer, size_t length, void * context);
+
+/*
+ * JsonStreamWriter buffers JSON text and hands it to a write callback a buffer at a time, so that
+ * large documents like heap snapshots and profiles can be streamed out without building them in
+ * memory. It doesn't allocate, so it can be used while the recycler's heap must not change.
+ *
+ * Strings are escaped so that the output stays ASCII. Once the callback fails, the rest of the
+ * output is dropped.
+ */
+class JsonStreamWriter
+{
+public:
+    JsonStreamWriter(JsonStreamWriteCallback writeCallback, void * writeContext);
+
+    void WriteRaw(char const * string);
+    void WriteChar(char c);
+    void WriteNumber(uint64 number);
+    // A null string is written out empty
+    void WriteString(char16 const * string);
+
+    // Returns false if the write callback failed
+    bool Flush();
+
+private:
+    static const size_t BufferSize = 4096;
+
+    JsonStreamWriteCallback writeCallback;
+    void * writeContext;
+    bool writeFailed;
+    size_t bufferLength;
+    char buffer[BufferSize];
+};
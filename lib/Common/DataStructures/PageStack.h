@@ -15,6 +15,11 @@ private:
     static const size_t EntriesPerChunk = (AutoSystemInfo::PageSize - sizeof(Chunk)) / sizeof(T);
 
 public:
+    // Full chunks can be published to a steal deque, so that other threads that run out of work
+    // can take them over with Steal.
+    static const uint StealDequeCapacity = 256;
+    typedef WorkStealingDeque<Chunk *, StealDequeCapacity> StealDeque;
+
     PageStack(PagePool * pagePool);
     ~PageStack();
 
@@ -26,6 +31,13 @@ public:
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
 
+    void SetStealDeque(StealDeque * stealDeque)
+    {
+        Assert(this->stealDeque == nullptr || this->stealDeque->IsEmpty());
+        this->stealDeque = stealDeque;
+    }
+    bool Steal(StealDeque * victimDeque);
+
     void Abort();
     void Release();
 
@@ -44,11 +56,13 @@ public:
     }
 #endif
 
-    static const uint MaxSplitTargets = 3;     // Not counting original stack, so this supports 4-way parallel
+    static const uint MaxSplitTargets = 31;    // Not counting original stack, so this supports 32-way parallel
 
 private:
     Chunk * CreateChunk();
     void FreeChunk(Chunk * chunk);
+    bool PublishChunk(Chunk * chunk);
+    void TakeChunk(Chunk * chunk);
 
 private:
     T * nextEntry;
@@ -56,6 +70,7 @@ private:
     T * chunkEnd;
     Chunk * currentChunk;
     PagePool * pagePool;
+    StealDeque * stealDeque;
     bool usesReservedPages;
 
 #if DBG
@@ -79,18 +94,27 @@ bool PageStack<T>::Pop(T * item)
         // We're at the beginning of the chunk.  Move to the previous chunk, if any
         if (currentChunk->nextChunk == nullptr)
         {
-            // All done
-            Assert(count == 0);
-            return false;
-        }
+            // Take back the most recently published chunk, unless it has been stolen already
+            Chunk * publishedChunk;
+            if (stealDeque == nullptr || !stealDeque->PopBottom(&publishedChunk))
+            {
+                // All done
+                Assert(count == 0);
+                return false;
+            }
 
-        Chunk * temp = currentChunk;
-        currentChunk = currentChunk->nextChunk;
-        FreeChunk(temp);
+            TakeChunk(publishedChunk);
+        }
+        else
+        {
+            Chunk * temp = currentChunk;
+            currentChunk = currentChunk->nextChunk;
+            FreeChunk(temp);
 
-        chunkStart = currentChunk->entries;
-        chunkEnd = &currentChunk->entries[EntriesPerChunk];
-        nextEntry = chunkEnd;
+            chunkStart = currentChunk->entries;
+            chunkEnd = &currentChunk->entries[EntriesPerChunk];
+            nextEntry = chunkEnd;
+        }
     }
 
     Assert(nextEntry > chunkStart && nextEntry <= chunkEnd);
@@ -121,7 +145,19 @@ bool PageStack<T>::Push(T item)
             return false;
         }
 
-        newChunk->nextChunk = currentChunk;
+        // The current chunk is full. Publish it for other threads to steal if we can,
+        // otherwise keep it on our own chunk list.
+        Chunk * fullChunk = currentChunk;
+        if (fullChunk != nullptr && stealDeque != nullptr)
+        {
+            Chunk * nextChunk = fullChunk->nextChunk;
+            if (PublishChunk(fullChunk))
+            {
+                fullChunk = nextChunk;
+            }
+        }
+
+        newChunk->nextChunk = fullChunk;
         currentChunk = newChunk;
 
         chunkStart = currentChunk->entries;
@@ -146,6 +182,7 @@ bool PageStack<T>::Push(T item)
 template <typename T>
 PageStack<T>::PageStack(PagePool * pagePool) :
     pagePool(pagePool),
+    stealDeque(nullptr),
     currentChunk(nullptr),
     nextEntry(nullptr),
     chunkStart(nullptr),
@@ -241,6 +278,82 @@ void PageStack<T>::FreeChunk(Chunk * chunk)
 }
 
 
+template <typename T>
+bool PageStack<T>::PublishChunk(Chunk * chunk)
+{
+    Assert(stealDeque != nullptr);
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    if (maxPageCount != (size_t)-1)
+    {
+        // Published chunks don't count against our page limit, so don't publish when
+        // the stack size is restricted.
+        return false;
+    }
+#endif
+
+    // Reserved pages have to stay with the page pool that reserved them
+    if (chunk->IsReserved() || !stealDeque->PushBottom(chunk))
+    {
+        return false;
+    }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    pageCount--;
+#endif
+#if DBG
+    count -= EntriesPerChunk;
+#endif
+    return true;
+}
+
+
+template <typename T>
+void PageStack<T>::TakeChunk(Chunk * chunk)
+{
+    // Replace our empty current chunk (if any) with a full chunk that was published
+    // to a steal deque, either by us or by another stack.
+    Assert(count == 0);
+
+    if (currentChunk != nullptr)
+    {
+        Assert(currentChunk->nextChunk == nullptr);
+        FreeChunk(currentChunk);
+    }
+
+    chunk->nextChunk = nullptr;
+    currentChunk = chunk;
+    chunkStart = chunk->entries;
+    chunkEnd = &chunk->entries[EntriesPerChunk];
+    nextEntry = chunkEnd;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    pageCount++;
+#endif
+#if DBG
+    count = EntriesPerChunk;
+#endif
+}
+
+
+template <typename T>
+bool PageStack<T>::Steal(StealDeque * victimDeque)
+{
+    // Only steal when we have run out of work ourselves.
+    Assert(IsEmpty());
+    Assert(victimDeque != stealDeque);
+
+    Chunk * chunk;
+    if (!victimDeque->Steal(&chunk))
+    {
+        return false;
+    }
+
+    TakeChunk(chunk);
+    return true;
+}
+
+
 template <typename T>
 uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks)
 {
@@ -249,6 +362,7 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 
     Assert(targetCount > 0 && targetCount <= MaxSplitTargets);
     Assert(targetStacks);
+    Assert(stealDeque == nullptr || stealDeque->IsEmpty());
     __analysis_assume(targetCount <= MaxSplitTargets);
 
     Chunk * mainCurrent;
@@ -361,6 +475,13 @@ void PageStack<T>::Abort()
 {
     // Abandon the current entries in the stack and reset to initialized state.
 
+    // Chunks we published don't count against the page count anymore, so just return them to the pool.
+    Chunk * publishedChunk;
+    while (stealDeque != nullptr && stealDeque->PopBottom(&publishedChunk))
+    {
+        this->pagePool->FreePage(publishedChunk);
+    }
+
     if (currentChunk == nullptr)
     {
         Assert(count == 0);
@@ -407,6 +528,11 @@ void PageStack<T>::Release()
 template <typename T>
 bool PageStack<T>::IsEmpty() const
 {
+    if (stealDeque != nullptr && !stealDeque->IsEmpty())
+    {
+        return false;
+    }
+
     if (currentChunk == nullptr)
     {
         Assert(count == 0);
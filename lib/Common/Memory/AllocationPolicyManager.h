@@ -7,8 +7,9 @@
 // and to track current page usage.
 //
 
-// NOTE: For now, we are only tracking reserved page count.
-// Consider whether we should also (or maybe only) track committed page count.
+// NOTE: The memory limit and the reported usage both apply to the reserved page count.
+// Pages that page allocators have reset instead of decommitting (see -LazyDecommit) are
+// counted separately, see GetResetBytes.
 
 class AllocationPolicyManager
 {
@@ -28,6 +29,7 @@ typedef bool (__stdcall * PageAllocatorMemoryAllocationCallback)(__in LPVOID con
 private:
     size_t memoryLimit;
     size_t currentMemory;
+    size_t resetMemory;
     bool supportConcurrency;
     CriticalSection cs;
     void * context;
@@ -37,6 +39,7 @@ public:
     AllocationPolicyManager(bool needConcurrencySupport) :
         memoryLimit((size_t)-1),
         currentMemory(0),
+        resetMemory(0),
         supportConcurrency(needConcurrencySupport),
         context(NULL),
         memoryAllocationCallback(NULL)
@@ -46,6 +49,7 @@ public:
     ~AllocationPolicyManager()
     {
         Assert(currentMemory == 0);
+        Assert(resetMemory == 0);
     }
 
     size_t GetUsage()
@@ -53,6 +57,12 @@ public:
         return currentMemory;
     }
 
+    // Part of the usage that is still committed but that the OS may take back at any time
+    size_t GetResetBytes()
+    {
+        return resetMemory;
+    }
+
     size_t GetLimit()
     {
         return memoryLimit;
@@ -104,6 +114,33 @@ public:
         }
     }
 
+    // Reset pages stay reserved, so they don't give room back under the limit
+    void ReportReset(size_t byteCount)
+    {
+        if (supportConcurrency)
+        {
+            AutoCriticalSection auto_cs(&cs);
+            resetMemory += byteCount;
+        }
+        else
+        {
+            resetMemory += byteCount;
+        }
+    }
+
+    void ReportResetReleased(size_t byteCount)
+    {
+        if (supportConcurrency)
+        {
+            AutoCriticalSection auto_cs(&cs);
+            ReportResetReleasedImpl(byteCount);
+        }
+        else
+        {
+            ReportResetReleasedImpl(byteCount);
+        }
+    }
+
     void SetMemoryAllocationCallback(LPVOID newContext, PageAllocatorMemoryAllocationCallback callback)
     {
         this->memoryAllocationCallback = callback;
@@ -148,6 +185,12 @@ private:
         }
     }
 
+    inline void ReportResetReleasedImpl(size_t byteCount)
+    {
+        Assert(resetMemory >= byteCount);
+        resetMemory = resetMemory - byteCount;
+    }
+
     inline void ReportFreeImpl(MemoryAllocateEvent allocationEvent, size_t byteCount)
     {
         Assert(currentMemory >= byteCount);
@@ -351,7 +351,7 @@ AddBigBlock(size_t requestBytes)
 
     size_t allocBytes = AllocSizeMath::Add(requestBytes, sizeof(BigBlock));
 
-    PageAllocation * allocation = this->GetPageAllocator()->AllocPagesForBytes(allocBytes);
+    PageAllocation * allocation = this->GetPageAllocator()->AllocArenaBlockForBytes(allocBytes);
 
     if (allocation == nullptr)
     {
@@ -359,7 +359,7 @@ AddBigBlock(size_t requestBytes)
         if (recoverMemoryFunc)
         {
             recoverMemoryFunc();
-            allocation = this->GetPageAllocator()->AllocPagesForBytes(allocBytes);
+            allocation = this->GetPageAllocator()->AllocArenaBlockForBytes(allocBytes);
         }
         if (allocation == nullptr)
         {
@@ -423,7 +423,7 @@ ReleasePageMemory()
     {
         PageAllocation * allocation = blockp->allocation;
         blockp = blockp->nextBigBlock;
-        GetPageAllocator()->ReleaseAllocationNoSuspend(allocation);
+        GetPageAllocator()->ReleaseArenaBlockNoSuspend(allocation);
     }
 
     blockp = fullBlocks;
@@ -431,7 +431,7 @@ ReleasePageMemory()
     {
         PageAllocation * allocation = blockp->allocation;
         blockp = blockp->nextBigBlock;
-        GetPageAllocator()->ReleaseAllocationNoSuspend(allocation);
+        GetPageAllocator()->ReleaseArenaBlockNoSuspend(allocation);
     }
 
 #ifdef ARENA_MEMORY_VERIFY
@@ -369,6 +369,10 @@ SmallHeapBlockT<TBlockAttributes>::Init(ushort objectSize, ushort objectCount)
 #if ENABLE_CONCURRENT_GC
     this->isPendingConcurrentSweep = false;
 #endif
+    this->isPretenured = false;
+#ifdef RECYCLER_STATS
+    this->isSparse = false;
+#endif
 
     Assert(!this->isInAllocator);
     Assert(!this->isClearedFromAllocator);
@@ -577,6 +581,10 @@ SmallHeapBlockT<TBlockAttributes>::Reset()
     this->ClearObjectInfoList();
 
     this->isInAllocator = false;
+    this->isPretenured = false;
+#ifdef RECYCLER_STATS
+    this->isSparse = false;
+#endif
 
 #if DBG || defined(RECYCLER_STATS)
     this->GetDebugFreeBitVector()->ClearAll();
@@ -1305,8 +1313,15 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
     const uint expectSweepCount = expectFreeCount - this->freeCount;
     Assert(!this->IsLeafBlock() || finalizeCount == 0);
 
+    // The slots freed in a pretenured block are never allocated from, so once most of its objects
+    // are dead, hand the block back to the normal allocators instead of keeping it for the few left
+    if (this->isPretenured && localMarkCount * 100 < objectCount * PretenuredBlockMinLivePercent)
+    {
+        this->isPretenured = false;
+    }
+
     Recycler * recycler = recyclerSweep.GetRecycler();
-    RECYCLER_STATS_INC(recycler, heapBlockCount[this->GetHeapBlockType()]);
+    RECYCLER_STATS_INTERLOCKED_INC(recycler, heapBlockCount[this->GetHeapBlockType()]);
 
 #if ENABLE_PARTIAL_GC
     if (recyclerSweep.DoAdjustPartialHeuristics() && allocable)
@@ -1328,7 +1343,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
         return SweepStateEmpty;
     }
 
-    RECYCLER_STATS_ADD(recycler, heapBlockFreeByteCount[this->GetHeapBlockType()], expectFreeCount * this->objectSize);
+    RECYCLER_STATS_INTERLOCKED_ADD(recycler, heapBlockFreeByteCount[this->GetHeapBlockType()], expectFreeCount * this->objectSize);
 
     Assert(!hasPendingDispose || (this->freeCount != 0));
     SweepState state = SweepStateSwept;
@@ -1344,7 +1359,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
         return (this->freeCount == 0) ? SweepStateFull : state;
     }
 
-    RECYCLER_STATS_INC(recycler, heapBlockSweptCount[this->GetHeapBlockType()]);
+    RECYCLER_STATS_INTERLOCKED_INC(recycler, heapBlockSweptCount[this->GetHeapBlockType()]);
 
     // We need to sweep in thread if there are any finalizable object.
     // So that the PrepareFinalize() can be called before concurrent sweep
@@ -1363,7 +1378,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
         Assert(!this->HasPendingDisposeObjects());
 
         recyclerSweep.SetHasPendingSweepSmallHeapBlocks();
-        RECYCLER_STATS_INC(recycler, heapBlockConcurrentSweptCount[this->GetHeapBlockType()]);
+        RECYCLER_STATS_INTERLOCKED_INC(recycler, heapBlockConcurrentSweptCount[this->GetHeapBlockType()]);
         // This heap block has objects that need to be swept concurrently.
         this->isPendingConcurrentSweep = true;
         return SweepStatePendingSweep;
@@ -1432,7 +1447,6 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
     {
         Assert(IsValidBitIndex(bitIndex));
 
-        RECYCLER_STATS_ADD(recycler, objectSweepScanCount, !isForceSweeping);
         if (!marked->Test(bitIndex))
         {
             if (!this->GetFreeBitVector()->Test(bitIndex))
@@ -1467,6 +1481,7 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
     }
 
     Assert(sweepCount == expectedSweepCount);
+    RECYCLER_STATS_INTERLOCKED_ADD(recycler, objectSweepScanCount, isForceSweeping ? 0 : localObjectCount);
 #if ENABLE_CONCURRENT_GC
     this->isPendingConcurrentSweep = false;
 #endif
@@ -1849,6 +1864,15 @@ template <class TBlockAttributes>
 void
 SmallHeapBlockT<TBlockAttributes>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
 {
+    if (infoBits == NoBit)
+    {
+        ForEachAllocatedObject([=](uint index, void * objectAddress)
+        {
+            CallBackFunction(objectAddress, this->objectSize);
+        });
+        return;
+    }
+
     ForEachAllocatedObject(infoBits, [=](uint index, void * objectAddress)
     {
         CallBackFunction(objectAddress, this->objectSize);
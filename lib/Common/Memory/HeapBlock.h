@@ -550,6 +550,10 @@ public:
     ushort oldFreeCount;
 #endif
     bool   isInAllocator;
+    bool   isPretenured;
+#ifdef RECYCLER_STATS
+    bool   isSparse;
+#endif
 #if DBG
     bool   isClearedFromAllocator;
 
@@ -643,6 +647,12 @@ public:
 
     bool IsInAllocator() const;
 
+    // Blocks created for a pretenured allocator keep holding only pretenured objects until a sweep finds
+    // fewer than PretenuredBlockMinLivePercent of their objects alive
+    static const uint PretenuredBlockMinLivePercent = 25;
+    bool IsPretenured() const { return isPretenured; }
+    void SetIsPretenured() { isPretenured = true; }
+
     bool HasPendingDisposeObjects();
     bool HasAnyDisposeObjects();
 
@@ -714,6 +724,12 @@ public:
     uint GetExpectedFreeBytes() const;
     ushort GetExpectedSweepObjectCount() const;
 
+#ifdef RECYCLER_STATS
+    // Set when the block was left at the end of the allocable list for being mostly empty
+    bool IsSparse() const { return isSparse; }
+    void SetIsSparse(bool isSparse) { this->isSparse = isSparse; }
+#endif
+
 #if DBG || defined(RECYCLER_STATS)
     SmallHeapBlockBitVector * GetDebugFreeBitVector() { return &debugFreeBits; }
 #endif
@@ -636,6 +636,27 @@ HeapBlockMap32::ResetDirtyPages(Recycler * recycler)
 }
 #endif
 
+#if ENABLE_PARTIAL_GC && defined(RECYCLER_WRITE_BARRIER)
+// Reset only the software write barrier cards, leaving the write watch alone.
+// Partial collections use this to start remembering old-to-young writes afresh once
+// every dirty page has been rescanned, the same way they reset write watch.
+void
+HeapBlockMap32::ResetWriteBarrierDirtyPages(Recycler * recycler)
+{
+    this->ForEachSegment(recycler, [=](char * segmentStart, size_t segmentLength, Segment * segment, PageAllocator * segmentPageAllocator) {
+
+        Assert(segmentLength % AutoSystemInfo::PageSize == 0);
+
+#if defined(_M_X64_OR_ARM64)
+        if (segment->IsWriteBarrierEnabled())
+#endif
+        {
+            RecyclerWriteBarrierManager::ResetWriteBarrier(segmentStart, segmentLength / AutoSystemInfo::PageSize);
+        }
+    });
+}
+#endif
+
 bool
 HeapBlockMap32::RescanPage(void * dirtyPage, bool* anyObjectsMarkedOnPage, Recycler * recycler)
 {
@@ -945,15 +966,20 @@ HeapBlockMap32::Rescan(Recycler * recycler, bool resetWriteWatch)
                 Assert(HeapBlockMap64::GetNodeStartAddress(pageAddress) == this->startAddress);
 #endif
 
-                // TODO: We are not resetting the write barrier here when RescanFlags_ResetWriteWatch is passed.
-                // We never have previously, but it still seems like we should.
-
                 BYTE writeBarrierByte = RecyclerWriteBarrierManager::GetWriteBarrier(pageAddress);
                 SwbVerboseTrace(recycler->GetRecyclerFlagsTable(), _u("Address: 0x%p, Write Barrier value: %u\n"), pageAddress, writeBarrierByte);
                 bool isDirty = (writeBarrierByte & DIRTYBIT);
 
                 if (isDirty)
                 {
+                    if (resetWriteWatch)
+                    {
+                        // Like GetWriteWatch with WRITE_WATCH_FLAG_RESET: clear the card before scanning the page,
+                        // so that a write racing with the scan dirties the card again instead of being lost.
+                        RecyclerWriteBarrierManager::ResetWriteBarrier(pageAddress, 1);
+                        MemoryBarrier();
+                    }
+
                     if (RescanPage(pageAddress, &anyObjectsScannedOnPage, recycler) && anyObjectsScannedOnPage)
                     {
                         scannedPageCount++;
@@ -1177,6 +1203,7 @@ HeapBlockMap32::Cleanup(bool concurrentFindImplicitRoot)
 HeapBlockMap64::HeapBlockMap64():
     list(nullptr)
 {
+    nodeFilter.ClearAll();
 }
 
 HeapBlockMap64::~HeapBlockMap64()
@@ -1377,6 +1404,12 @@ HeapBlockMap64::FindOrInsertNode(void * address)
         {
             node->nodeIndex = GetNodeIndex(address);
             node->next = list;
+
+            // Set the filter bit first, so that whoever can see the node in the list can also get to it
+            if (node->nodeIndex < NodeFilterBitCount)
+            {
+                nodeFilter.Set(node->nodeIndex);
+            }
 #ifdef _M_ARM64
             // For ARM we need to make sure that the list remains traversable during this insert.
             MemoryBarrier();
@@ -1392,6 +1425,10 @@ HeapBlockMap64::Node *
 HeapBlockMap64::FindNode(void * address) const
 {
     uint index = GetNodeIndex(address);
+    if (!MayHaveNode(index))
+    {
+        return nullptr;
+    }
 
     Node * node = list;
     while (node != nullptr)
@@ -1447,6 +1484,19 @@ HeapBlockMap64::ResetDirtyPages(Recycler * recycler)
 }
 #endif
 
+#if ENABLE_PARTIAL_GC && defined(RECYCLER_WRITE_BARRIER)
+void
+HeapBlockMap64::ResetWriteBarrierDirtyPages(Recycler * recycler)
+{
+    Node * node = this->list;
+    while (node != nullptr)
+    {
+        node->map.ResetWriteBarrierDirtyPages(recycler);
+        node = node->next;
+    }
+}
+#endif
+
 void
 HeapBlockMap64::MakeAllPagesReadOnly(Recycler* recycler)
 {
@@ -1500,6 +1550,10 @@ HeapBlockMap64::Cleanup(bool concurrentFindImplicitRoot)
             // Concurrent traversals of the node list would result in a race and possible UAF.
             // Currently we simply defer node free for the lifetime of the heap (only affects MemProtect).
             *prevnext = node->next;
+            if (node->nodeIndex < NodeFilterBitCount)
+            {
+                nodeFilter.Clear(node->nodeIndex);
+            }
             NoMemProtectHeapDelete(node);
         }
         else
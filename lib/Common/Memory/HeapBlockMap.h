@@ -68,6 +68,9 @@ public:
 #if ENABLE_CONCURRENT_GC || ENABLE_PARTIAL_GC
     void ResetDirtyPages(Recycler * recycler);
     uint Rescan(Recycler * recycler, bool resetWriteWatch);
+#endif
+#if ENABLE_PARTIAL_GC && defined(RECYCLER_WRITE_BARRIER)
+    void ResetWriteBarrierDirtyPages(Recycler * recycler);
 #endif
     void MakeAllPagesReadOnly(Recycler* recycler);
     void MakeAllPagesReadWrite(Recycler* recycler);
@@ -262,6 +265,9 @@ public:
 #if ENABLE_CONCURRENT_GC || ENABLE_PARTIAL_GC
     void ResetDirtyPages(Recycler * recycler);
     uint Rescan(Recycler * recycler, bool resetWriteWatch);
+#endif
+#if ENABLE_PARTIAL_GC && defined(RECYCLER_WRITE_BARRIER)
+    void ResetWriteBarrierDirtyPages(Recycler * recycler);
 #endif
     void MakeAllPagesReadOnly(Recycler* recycler);
     void MakeAllPagesReadWrite(Recycler* recycler);
@@ -301,6 +307,16 @@ private:
         return (uint)((ULONG64)address >> 32);
     }
 
+    // One bit per possible node in a 48 bit address space, set while the node is in the list.
+    // Most candidates that don't point into the heap are rejected with a single bit test,
+    // without walking the list. Nodes beyond the filter (if any) are always looked up.
+    static const uint NodeFilterBitCount = 1 << 16;
+
+    bool MayHaveNode(uint index) const
+    {
+        return index >= NodeFilterBitCount || this->nodeFilter.Test(index);
+    }
+
     Node * FindOrInsertNode(void * address);
     Node * FindNode(void * address) const;
 
@@ -308,6 +324,7 @@ private:
     void ForEachNodeInAddressRange(void * address, size_t pageCount, Fn fn);
 
     Node * list;
+    BVStatic<NodeFilterBitCount> nodeFilter;
 
 public:
 #if DBG
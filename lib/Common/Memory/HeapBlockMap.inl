@@ -456,6 +456,10 @@ HeapBlockMap64::Mark(void * candidate, MarkContext * markContext)
         return;
     }
     uint index = GetNodeIndex(candidate);
+    if (!MayHaveNode(index))
+    {
+        return;
+    }
 
     Node * node = list;
     while (node != nullptr)
@@ -484,6 +488,10 @@ HeapBlockMap64::MarkInterior(void * candidate, MarkContext * markContext)
         return;
     }
     uint index = GetNodeIndex(candidate);
+    if (!MayHaveNode(index))
+    {
+        return;
+    }
 
     Node * node = list;
     while (node != nullptr)
@@ -456,7 +456,21 @@ HeapBucketT<TBlockType>::TryAlloc(Recycler * recycler, TBlockAllocatorType * all
 
     ClearAllocator(allocator);
 
+    // Pretenured allocators only take new heap blocks, so that their objects don't share blocks with
+    // short-lived ones. Normal allocators in turn skip the pretenured blocks: to the checks, a skipped
+    // block looks like one that was allocated from and cleared from the allocator.
+    if (allocator->IsPretenured())
+    {
+        return nullptr;
+    }
+
     TBlockType * heapBlock = this->nextAllocableBlockHead;
+    while (heapBlock != nullptr && heapBlock->IsPretenured())
+    {
+        DebugOnly(heapBlock->SetIsClearedFromAllocator(true));
+        heapBlock = heapBlock->GetNextBlock();
+        this->nextAllocableBlockHead = heapBlock;
+    }
 #if ENABLE_CONCURRENT_GC && ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 
 #if SUPPORT_WIN32_SLIST && ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP_USE_SLIST
     bool heapBlockInSweepableList = false;
@@ -468,14 +482,17 @@ HeapBucketT<TBlockType>::TryAlloc(Recycler * recycler, TBlockAllocatorType * all
         // allocation are stopped.
         debugSweepableHeapBlockListLock.Enter();
 #endif
-        heapBlock = PopHeapBlockFromSList(this->allocableHeapBlockListHead);
-        if (heapBlock != nullptr)
+        while ((heapBlock = PopHeapBlockFromSList(this->allocableHeapBlockListHead)) != nullptr)
         {
             // Put the block in the sweepable heap block list so we don't lose track of it. The block will eventually be moved to the 
             // heapBlockList or fullBlockList as appropriate during the next sweep.
             heapBlock->SetNextBlock(sweepableHeapBlockList);
             sweepableHeapBlockList = heapBlock;
-            heapBlockInSweepableList = true;
+            if (!heapBlock->IsPretenured())
+            {
+                heapBlockInSweepableList = true;
+                break;
+            }
         }
 #if DBG|| defined(RECYCLER_SLOW_CHECK_ENABLED)
         debugSweepableHeapBlockListLock.Leave();
@@ -538,6 +555,11 @@ HeapBucketT<TBlockType>::TryAllocFromNewHeapBlock(Recycler * recycler, TBlockAll
         return nullptr;
     }
 
+    if (allocator->IsPretenured())
+    {
+        heapBlock->SetIsPretenured();
+    }
+
     // new heap block added, allocate from that.
     allocator->SetNew(heapBlock);
     // We just created a block we can allocate on
@@ -940,15 +962,16 @@ void
 HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlockType * heapBlockList, bool allocable)
 {
 #if DBG
+    RecyclerVerifyListConsistencyData& verifyListConsistencyData = recyclerSweep.GetVerifyListConsistencyData();
     if (TBlockType::HeapBlockAttributes::IsSmallBlock)
     {
-        Assert(recyclerSweep.smallBlockVerifyListConsistencyData.hasSetupVerifyListConsistencyData);
-        recyclerSweep.smallBlockVerifyListConsistencyData.hasSetupVerifyListConsistencyData = false;
+        Assert(verifyListConsistencyData.smallBlockVerifyListConsistencyData.hasSetupVerifyListConsistencyData);
+        verifyListConsistencyData.smallBlockVerifyListConsistencyData.hasSetupVerifyListConsistencyData = false;
     }
     else if (TBlockType::HeapBlockAttributes::IsMediumBlock)
     {
-        Assert(recyclerSweep.mediumBlockVerifyListConsistencyData.hasSetupVerifyListConsistencyData);
-        recyclerSweep.mediumBlockVerifyListConsistencyData.hasSetupVerifyListConsistencyData = false;
+        Assert(verifyListConsistencyData.mediumBlockVerifyListConsistencyData.hasSetupVerifyListConsistencyData);
+        verifyListConsistencyData.mediumBlockVerifyListConsistencyData.hasSetupVerifyListConsistencyData = false;
     }
     else
     {
@@ -978,11 +1001,11 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
     HeapBlockList::ForEachEditing(heapBlockList, [=, &recyclerSweep](TBlockType * heapBlock)
     {
         // The whole list need to be consistent
-        DebugOnly(VerifyBlockConsistencyInList(heapBlock, recyclerSweep));
+        DebugOnly(VerifyBlockConsistencyInList(heapBlock, recyclerSweep.GetVerifyListConsistencyData()));
 
         SweepState state = heapBlock->Sweep(recyclerSweep, queuePendingSweep, allocable);
 
-        DebugOnly(VerifyBlockConsistencyInList(heapBlock, recyclerSweep, state));
+        DebugOnly(VerifyBlockConsistencyInList(heapBlock, recyclerSweep.GetVerifyListConsistencyData(), state));
 
         switch (state)
         {
@@ -1041,6 +1064,9 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
             Assert(!heapBlock->HasFreeObject());
             heapBlock->SetNextBlock(this->fullBlockList);
             this->fullBlockList = heapBlock;
+#ifdef RECYCLER_STATS
+            heapBlock->SetIsSparse(false);
+#endif
             break;
         }
         case SweepStateEmpty:
@@ -1054,7 +1080,15 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
             }
 #endif
 
-            RECYCLER_STATS_INC(recycler, numEmptySmallBlocks[heapBlock->GetHeapBlockType()]);
+            RECYCLER_STATS_INTERLOCKED_INC(recycler, numEmptySmallBlocks[heapBlock->GetHeapBlockType()]);
+#ifdef RECYCLER_STATS
+            if (heapBlock->IsSparse())
+            {
+                RECYCLER_STATS_INTERLOCKED_INC(recycler, sparseLeafBlockReclaimedCount);
+                RECYCLER_STATS_INTERLOCKED_ADD(recycler, sparseLeafBlockReclaimedBytes, heapBlock->GetPageCount() * AutoSystemInfo::PageSize);
+                heapBlock->SetIsSparse(false);
+            }
+#endif
 
 #if ENABLE_CONCURRENT_GC
             // CONCURRENT-TODO: Finalizable block never have background == true and always be processed
@@ -1069,7 +1103,7 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
                 // CONCURRENT-TODO: We will zero heap block even if the number free page pool exceed
                 // the maximum and will get decommitted anyway
                 recyclerSweep.template QueueEmptyHeapBlock<TBlockType>(this, heapBlock);
-                RECYCLER_STATS_INC(recycler, numZeroedOutSmallBlocks);
+                RECYCLER_STATS_INTERLOCKED_INC(recycler, numZeroedOutSmallBlocks);
             }
             else
 #endif
@@ -1132,11 +1166,11 @@ HeapBucketT<TBlockType>::SweepBucket(RecyclerSweep& recyclerSweep)
 #if DBG
     if (TBlockType::HeapBlockAttributes::IsSmallBlock)
     {
-        recyclerSweep.SetupVerifyListConsistencyDataForSmallBlock((SmallHeapBlock*) savedNextAllocableBlockHead, true, false);
+        recyclerSweep.GetVerifyListConsistencyData().SetupVerifyListConsistencyDataForSmallBlock((SmallHeapBlock*) savedNextAllocableBlockHead, true, false);
     }
     else if (TBlockType::HeapBlockAttributes::IsMediumBlock)
     {
-        recyclerSweep.SetupVerifyListConsistencyDataForMediumBlock((MediumHeapBlock*) savedNextAllocableBlockHead, true, false);
+        recyclerSweep.GetVerifyListConsistencyData().SetupVerifyListConsistencyDataForMediumBlock((MediumHeapBlock*) savedNextAllocableBlockHead, true, false);
     }
     else
     {
@@ -1155,11 +1189,11 @@ HeapBucketT<TBlockType>::SweepBucket(RecyclerSweep& recyclerSweep)
 #if DBG
     if (TBlockType::HeapBlockAttributes::IsSmallBlock)
     {
-        recyclerSweep.SetupVerifyListConsistencyDataForSmallBlock(nullptr, true, false);
+        recyclerSweep.GetVerifyListConsistencyData().SetupVerifyListConsistencyDataForSmallBlock(nullptr, true, false);
     }
     else if (TBlockType::HeapBlockAttributes::IsMediumBlock)
     {
-        recyclerSweep.SetupVerifyListConsistencyDataForMediumBlock(nullptr, true, false);
+        recyclerSweep.GetVerifyListConsistencyData().SetupVerifyListConsistencyDataForMediumBlock(nullptr, true, false);
     }
     else
     {
@@ -1171,6 +1205,70 @@ HeapBucketT<TBlockType>::SweepBucket(RecyclerSweep& recyclerSweep)
 
     // We shouldn't have allocate from any block yet
     Assert(this->nextAllocableBlockHead == nullptr);
+
+    if (IsLeafBucket && recyclerSweep.GetRecycler()->GetRecyclerFlagsTable().LeafBlockDensityOrdering)
+    {
+        this->OrderHeapBlockListByDensity(recyclerSweep.GetRecycler());
+    }
+}
+
+// The recycler is conservative and never moves objects, so a sparse block can't be evacuated.
+// Instead, for leaf buckets, we hand out the densest blocks first and leave the sparsest ones
+// at the end of the list. Allocations then pack into the blocks that are already mostly live,
+// and the survivors in the sparse blocks get a chance to die off so that the whole block comes
+// back empty on a later sweep and its pages are released.
+template <typename TBlockType>
+void
+HeapBucketT<TBlockType>::OrderHeapBlockListByDensity(Recycler * recycler)
+{
+    Assert(IsLeafBucket);
+    Assert(this->nextAllocableBlockHead == nullptr);
+
+    // Bin the blocks by quarter of live objects. This is a stable, linear time approximation of sorting
+    // by density; the blocks on the allocable list always have at least one free object, so the
+    // marked count is below the object count and the bin index stays below BinCount.
+    const uint BinCount = 4;
+    TBlockType * binHead[BinCount] = { nullptr };
+    TBlockType * binTail[BinCount] = { nullptr };
+
+    HeapBlockList::ForEachEditing(this->heapBlockList, [&](TBlockType * heapBlock)
+    {
+        Assert(heapBlock->HasFreeObject());
+        uint bin = (heapBlock->GetMarkedCount() * BinCount) / heapBlock->GetObjectCount();
+        Assert(bin < BinCount);
+
+#ifdef RECYCLER_STATS
+        heapBlock->SetIsSparse(bin == 0);
+        if (bin == 0)
+        {
+            RECYCLER_STATS_INTERLOCKED_INC(recycler, sparseLeafBlockCount);
+            RECYCLER_STATS_INTERLOCKED_ADD(recycler, sparseLeafBlockFreeBytes, heapBlock->GetExpectedFreeBytes());
+        }
+#endif
+
+        heapBlock->SetNextBlock(nullptr);
+        if (binTail[bin] == nullptr)
+        {
+            binHead[bin] = heapBlock;
+        }
+        else
+        {
+            binTail[bin]->SetNextBlock(heapBlock);
+        }
+        binTail[bin] = heapBlock;
+    });
+
+    // Relink from the densest bin to the sparsest one
+    TBlockType * head = nullptr;
+    for (uint i = 0; i < BinCount; i++)
+    {
+        if (binHead[i] != nullptr)
+        {
+            binTail[i]->SetNextBlock(head);
+            head = binHead[i];
+        }
+    }
+    this->heapBlockList = head;
 }
 
 template <typename TBlockType>
@@ -1657,6 +1755,29 @@ HeapBucketGroup<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep)
 #endif
 }
 
+#if ENABLE_CONCURRENT_GC
+template <class TBlockAttributes>
+void
+HeapBucketGroup<TBlockAttributes>::SweepBucket(RecyclerSweep& recyclerSweep, uint index)
+{
+    Assert(index < SweepBucketCount);
+    switch (index)
+    {
+    case 0:
+        heapBucket.Sweep(recyclerSweep);
+        break;
+    case 1:
+        leafHeapBucket.Sweep(recyclerSweep);
+        break;
+#ifdef RECYCLER_WRITE_BARRIER
+    case 2:
+        smallNormalWithBarrierHeapBucket.Sweep(recyclerSweep);
+        break;
+#endif
+    }
+}
+#endif
+
 // Sweep finalizable objects first to ensure that if they reference any other
 // objects in the finalizer - they are valid
 template <class TBlockAttributes>
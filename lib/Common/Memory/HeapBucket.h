@@ -253,6 +253,7 @@ protected:
     bool IsAllocationStopped() const;
 
     void SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlockType * heapBlockList, bool allocable);
+    void OrderHeapBlockListByDensity(Recycler * recycler);
 #if ENABLE_PARTIAL_GC
     bool DoQueuePendingSweep(Recycler * recycler);
     bool DoPartialReuseSweep(Recycler * recycler);
@@ -459,6 +459,7 @@ HeapInfo::HeapInfo() :
     newMediumRecyclerVisitedHostHeapBlockList(nullptr),
 #endif
     newMediumFinalizableHeapBlockList(nullptr),
+    nextSweepBucketIndex(0),
 #endif
 #ifdef RECYCLER_FINALIZE_CHECK
     liveFinalizableObjectCount(0),
@@ -956,10 +957,10 @@ HeapInfo::ScanNewImplicitRoots()
 }
 
 LargeHeapBlock *
-HeapInfo::AddLargeHeapBlock(size_t size)
+HeapInfo::AddLargeHeapBlock(size_t size, bool dedicated)
 {
     // Do a no-throwing allocation here
-    return largeObjectBucket.AddLargeHeapBlock(size, /* nothrow = */ true);
+    return largeObjectBucket.AddLargeHeapBlock(size, /* nothrow = */ true, dedicated);
 }
 
 void HeapInfo::SweepBuckets(RecyclerSweep& recyclerSweep, bool concurrent)
@@ -1101,17 +1102,36 @@ HeapInfo::SweepSmallNonFinalizable(RecyclerSweep& recyclerSweep)
         // until  we are going to sweep leaf pages.
         recycler->GetRecyclerLeafPageAllocator()->SuspendIdleDecommit();
     }
-    for (uint i=0; i<HeapConstants::BucketCount; i++)
+
+#if ENABLE_CONCURRENT_GC
+    if (recyclerSweep.IsBackground())
     {
-        heapBuckets[i].Sweep(recyclerSweep);
+        // Share the buckets with the parallel threads if we can, and sweep whatever they don't claim here
+        this->nextSweepBucketIndex = 0;
+        bool parallelSweep = recycler->StartParallelSweep();
+
+        this->SweepSmallNonFinalizableBuckets(recyclerSweep);
+
+        if (parallelSweep)
+        {
+            recycler->FinishParallelSweep();
+        }
     }
+    else
+#endif
+    {
+        for (uint i=0; i<HeapConstants::BucketCount; i++)
+        {
+            heapBuckets[i].Sweep(recyclerSweep);
+        }
 
 #if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
-    for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
-    {
-        mediumHeapBuckets[i].Sweep(recyclerSweep);
-    }
+        for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
+        {
+            mediumHeapBuckets[i].Sweep(recyclerSweep);
+        }
 #endif
+    }
 
     if (!recyclerSweep.IsBackground())
     {
@@ -1123,6 +1143,53 @@ HeapInfo::SweepSmallNonFinalizable(RecyclerSweep& recyclerSweep)
     }
 }
 
+#if ENABLE_CONCURRENT_GC
+void
+HeapInfo::SweepSmallNonFinalizableBuckets(RecyclerSweep& recyclerSweep)
+{
+    // Claim the buckets one at a time, so a thread that gets buckets with few heap blocks just claims more of them.
+    // This may run on several threads at once, so the recycler stats updated while sweeping use the interlocked forms.
+    const uint smallSweepBucketCount = HeapConstants::BucketCount * HeapBucketGroup<SmallAllocationBlockAttributes>::SweepBucketCount;
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    const uint sweepBucketCount = smallSweepBucketCount + HeapConstants::MediumBucketCount * HeapBucketGroup<MediumAllocationBlockAttributes>::SweepBucketCount;
+#else
+    const uint sweepBucketCount = smallSweepBucketCount;
+#endif
+
+#if DBG
+    RecyclerVerifyListConsistencyData verifyListConsistencyData;
+    RecyclerSweep::SetThreadVerifyListConsistencyData(&verifyListConsistencyData);
+#endif
+
+    while (true)
+    {
+        uint index = (uint)(::InterlockedIncrement(&this->nextSweepBucketIndex) - 1);
+        if (index >= sweepBucketCount)
+        {
+            break;
+        }
+
+        if (index < smallSweepBucketCount)
+        {
+            const uint groupSweepBucketCount = HeapBucketGroup<SmallAllocationBlockAttributes>::SweepBucketCount;
+            heapBuckets[index / groupSweepBucketCount].SweepBucket(recyclerSweep, index % groupSweepBucketCount);
+        }
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+        else
+        {
+            const uint groupSweepBucketCount = HeapBucketGroup<MediumAllocationBlockAttributes>::SweepBucketCount;
+            index -= smallSweepBucketCount;
+            mediumHeapBuckets[index / groupSweepBucketCount].SweepBucket(recyclerSweep, index % groupSweepBucketCount);
+        }
+#endif
+    }
+
+#if DBG
+    RecyclerSweep::SetThreadVerifyListConsistencyData(nullptr);
+#endif
+}
+#endif
+
 size_t
 HeapInfo::Rescan(RescanFlags flags)
 {
@@ -185,7 +185,7 @@ private:
 #endif
 #endif
 
-    LargeHeapBlock * AddLargeHeapBlock(size_t pageCount);
+    LargeHeapBlock * AddLargeHeapBlock(size_t pageCount, bool dedicated);
 
     template <typename TBlockType>
     void AppendNewHeapBlock(TBlockType * heapBlock, HeapBucketT<TBlockType> * heapBucket)
@@ -286,6 +286,9 @@ private:
 #endif
 
     void SweepSmallNonFinalizable(RecyclerSweep& recyclerSweep);
+#if ENABLE_CONCURRENT_GC
+    void SweepSmallNonFinalizableBuckets(RecyclerSweep& recyclerSweep);
+#endif
     void SweepLargeNonFinalizable(RecyclerSweep& recyclerSweep);
 
 #if DBG || defined(RECYCLER_SLOW_CHECK_ENABLED)
@@ -438,6 +441,9 @@ private:
     MediumNormalWithBarrierHeapBlock * newMediumNormalWithBarrierHeapBlockList;
     MediumFinalizableWithBarrierHeapBlock * newMediumFinalizableWithBarrierHeapBlockList;
 #endif
+
+    // Next bucket to be claimed by the threads sweeping in the background
+    volatile LONG nextSweepBucketIndex;
 #endif
 
 #ifdef RECYCLER_PAGE_HEAP
@@ -90,6 +90,10 @@ IdleDecommitPageAllocator::LeaveIdleDecommit(bool allowTimer)
         return IdleDecommitSignal_None;
     }
 
+    // The cached arena blocks are only worth keeping while script runs. Give them back as free pages
+    // so that they are decommitted with the rest.
+    this->ReleaseArenaBlockCache();
+
 #ifdef IDLE_DECOMMIT_ENABLED
     if (allowTimer)
     {
@@ -1090,7 +1090,14 @@ bool LargeHeapBlock::IsPageDirty(char* page, RescanFlags flags, bool isWriteBarr
     }
     if (isWriteBarrier)
     {
-        return (RecyclerWriteBarrierManager::GetWriteBarrier(page) & DIRTYBIT) == DIRTYBIT;
+        bool isDirty = (RecyclerWriteBarrierManager::GetWriteBarrier(page) & DIRTYBIT) == DIRTYBIT;
+        if (isDirty && (flags & RescanFlags_ResetWriteWatch))
+        {
+            // Clear the card before the caller scans the page, see HeapBlockMap32::Rescan
+            RecyclerWriteBarrierManager::ResetWriteBarrier(page, 1);
+            MemoryBarrier();
+        }
+        return isDirty;
     }
 #endif
 
@@ -1943,7 +1950,7 @@ LargeHeapBlock::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunctio
         {
             continue;
         }
-        if ((header->GetAttributes(this->heapInfo->recycler->Cookie) & infoBits) != 0)
+        if (infoBits == NoBit || (header->GetAttributes(this->heapInfo->recycler->Cookie) & infoBits) != 0)
         {
             CallBackFunction(header->GetAddress(), header->objectSize);
         }
@@ -290,7 +290,7 @@ LargeHeapBucket::PageHeapAlloc(Recycler * recycler, size_t sizeCat, size_t size,
 #endif
 
 LargeHeapBlock*
-LargeHeapBucket::AddLargeHeapBlock(size_t size, bool nothrow)
+LargeHeapBucket::AddLargeHeapBlock(size_t size, bool nothrow, bool dedicated)
 {
     Recycler* recycler = this->heapInfo->recycler;
     Segment * segment;
@@ -320,7 +320,9 @@ LargeHeapBucket::AddLargeHeapBlock(size_t size, bool nothrow)
 #ifdef RECYCLER_ZERO_MEM_CHECK
     recycler->VerifyZeroFill(address, pageCount * AutoSystemInfo::PageSize);
 #endif
-    uint objectCount = LargeHeapBlock::GetMaxLargeObjectCount(pageCount, size);
+    // A dedicated block only ever holds the one object, so that none of the objects allocated after it
+    // can keep its pages alive once it is gone
+    uint objectCount = dedicated ? 1 : LargeHeapBlock::GetMaxLargeObjectCount(pageCount, size);
     LargeHeapBlock * heapBlock = LargeHeapBlock::New(address, pageCount, segment, objectCount, this);
 #if DBG
     LargeAllocationVerboseTrace(recycler->GetRecyclerFlagsTable(), _u("Allocated new large heap block 0x%p for sizeCat 0x%x\n"), heapBlock, sizeCat);
@@ -363,8 +365,17 @@ LargeHeapBucket::AddLargeHeapBlock(size_t size, bool nothrow)
         return nullptr;
     }
 
-    heapBlock->SetNextBlock(this->largeBlockList);
-    this->largeBlockList = heapBlock;
+    if (dedicated)
+    {
+        // The caller allocates the object right away, keep the block off the list we bump allocate from
+        heapBlock->SetNextBlock(this->fullLargeBlockList);
+        this->fullLargeBlockList = heapBlock;
+    }
+    else
+    {
+        heapBlock->SetNextBlock(this->largeBlockList);
+        this->largeBlockList = heapBlock;
+    }
 
     RECYCLER_PERF_COUNTER_ADD(FreeObjectSize, heapBlock->GetPageCount() * AutoSystemInfo::PageSize);
     return heapBlock;
@@ -687,7 +698,13 @@ LargeHeapBucket::ReinsertLargeHeapBlock(LargeHeapBlock * heapBlock)
     Assert(!heapBlock->hasPartialFreeObjects);
     Assert(!heapBlock->IsInPendingDisposeList());
 
-    if (this->largeBlockList != nullptr && heapBlock->GetFreeSize() > this->largeBlockList->GetFreeSize())
+    if (heapBlock->allocCount == heapBlock->objectCount)
+    {
+        // No header left for another object (e.g. a dedicated block), even if there is free space
+        heapBlock->SetNextBlock(this->fullLargeBlockList);
+        this->fullLargeBlockList = heapBlock;
+    }
+    else if (this->largeBlockList != nullptr && heapBlock->GetFreeSize() > this->largeBlockList->GetFreeSize())
     {
         heapBlock->SetNextBlock(this->largeBlockList->GetNextBlock());
         this->largeBlockList->SetNextBlock(this->fullLargeBlockList);
@@ -22,6 +22,13 @@ private:
 public:
     static const int MarkCandidateSize = sizeof(MarkCandidate);
 
+    // Max number of contexts a mark context can be split into (not counting itself),
+    // and thus the max number of threads that can mark in parallel.
+    static const uint MaxSplitTargets = PageStack<MarkCandidate>::MaxSplitTargets;
+    static const uint MaxParallelism = MaxSplitTargets + 1;
+
+    typedef PageStack<MarkCandidate>::StealDeque MarkStealDeque;
+
     MarkContext(Recycler * recycler, PagePool * pagePool);
     ~MarkContext();
 
@@ -48,12 +55,21 @@ public:
     void ScanMemory(void ** obj, size_t byteCount);
     template <bool parallel, bool interior>
     void ProcessMark();
+    // Like ProcessMark, but reports each object taken off the mark stack before it is scanned. Precisely
+    // traced objects aren't reported.
+    template <bool parallel, bool interior, typename ScanFn>
+    void ProcessMark(ScanFn onScanObject);
 
     void MarkTrackedObject(FinalizableObject * obj);
     void ProcessTracked();
 
     uint Split(uint targetCount, __in_ecount(targetCount) MarkContext ** targetContexts);
 
+    // Work stealing during parallel mark: while a steal deque is set, full mark stack chunks are
+    // published to it, and other contexts that run out of work can steal them.
+    void SetStealDeque(MarkStealDeque * stealDeque) { markStack.SetStealDeque(stealDeque); }
+    bool StealMarkWork(MarkStealDeque * victimDeque) { return markStack.Steal(victimDeque); }
+
     void Abort();
     void Release();
 
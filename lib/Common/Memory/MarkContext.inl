@@ -258,3 +258,36 @@ void MarkContext::ProcessMark()
 #endif
     }
 }
+
+template <bool parallel, bool interior, typename ScanFn>
+inline
+void MarkContext::ProcessMark(ScanFn onScanObject)
+{
+#ifdef RECYCLER_VISITED_HOST
+    while (!markStack.IsEmpty() || !preciseStack.IsEmpty())
+#endif
+    {
+        MarkCandidate current;
+        while (markStack.Pop(&current))
+        {
+            onScanObject((void *)current.obj);
+            ScanObject<parallel, interior>(current.obj, current.byteCount);
+        }
+
+        Assert(markStack.IsEmpty());
+
+#ifdef RECYCLER_VISITED_HOST
+        if (!preciseStack.IsEmpty())
+        {
+            MarkContextWrapper<parallel> markContextWrapper(this);
+            IRecyclerVisitedObject* tracedObject;
+            while (preciseStack.Pop(&tracedObject))
+            {
+                tracedObject->Trace(&markContextWrapper);
+            }
+        }
+
+        Assert(preciseStack.IsEmpty());
+#endif
+    }
+}
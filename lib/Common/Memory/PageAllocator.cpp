@@ -40,6 +40,7 @@ SegmentBase<T>::SegmentBase(PageAllocatorBase<T> * allocator, size_t pageCount,
     , isWriteBarrierAllowed(false)
     , isWriteBarrierEnabled(enableWriteBarrier)
 #endif
+    , releaseToPageSegmentCache(false)
 {
     this->segmentPageCount = pageCount + secondaryAllocPageCount;
 }
@@ -60,7 +61,6 @@ SegmentBase<T>::~SegmentBase()
     if (this->address)
     {
         char* originalAddress = this->address - (leadingGuardPageCount * AutoSystemInfo::PageSize);
-        GetAllocator()->GetVirtualAllocator()->Free(originalAddress, GetPageCount() * AutoSystemInfo::PageSize, MEM_RELEASE);
         GetAllocator()->ReportFree(this->segmentPageCount * AutoSystemInfo::PageSize); //Note: We reported the guard pages free when we decommitted them during segment initialization
 #if defined(_M_X64_OR_ARM64) && defined(RECYCLER_WRITE_BARRIER_BYTE)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
@@ -71,9 +71,33 @@ SegmentBase<T>::~SegmentBase()
 #endif
         RecyclerWriteBarrierManager::OnSegmentFree(this->address, this->segmentPageCount);
 #endif
+
+        // Once the segment is in the cache another thread may take it and register it again,
+        // so only hand it over after the card table is done with it
+        if (!this->releaseToPageSegmentCache || !PageSegmentCache::Put(originalAddress, GetPageCount()))
+        {
+            GetAllocator()->GetVirtualAllocator()->Free(originalAddress, GetPageCount() * AutoSystemInfo::PageSize, MEM_RELEASE);
+        }
     }
 }
 
+template<typename T>
+bool
+SegmentBase<T>::CanUsePageSegmentCache(DWORD allocFlags, bool addGuardPages) const
+{
+#ifdef PAGEALLOCATOR_PROTECT_FREEPAGE
+    return false;
+#else
+    // The cache only holds plain committed read/write memory from VirtualAllocWrapper in this process
+    return allocFlags == MEM_COMMIT
+        && !addGuardPages
+        && this->secondaryAllocPageCount == 0
+        && !this->IsInCustomHeapAllocator()
+        && GetAllocator()->GetAllocatorType() == PageAllocatorBaseCommon::AllocatorType::VirtualAlloc
+        && GetAllocator()->processHandle == GetCurrentProcess();
+#endif
+}
+
 template<typename T>
 bool
 SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
@@ -116,7 +140,15 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
         return false;
     }
 
-    this->address = (char *)GetAllocator()->GetVirtualAllocator()->Alloc(NULL, totalPages * AutoSystemInfo::PageSize, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator());
+    if (this->CanUsePageSegmentCache(allocFlags, addGuardPages))
+    {
+        this->address = PageSegmentCache::Get(totalPages);
+    }
+
+    if (this->address == nullptr)
+    {
+        this->address = (char *)GetAllocator()->GetVirtualAllocator()->Alloc(NULL, totalPages * AutoSystemInfo::PageSize, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator());
+    }
 
     if (this->address == nullptr)
     {
@@ -209,7 +241,7 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
 
 template<typename T>
 PageSegmentBase<T>::PageSegmentBase(PageAllocatorBase<T> * allocator, bool committed, bool allocated, bool enableWriteBarrier) :
-    SegmentBase<T>(allocator, allocator->maxAllocPageCount, enableWriteBarrier), decommitPageCount(0)
+    SegmentBase<T>(allocator, allocator->maxAllocPageCount, enableWriteBarrier), decommitPageCount(0), lazyDecommit(false)
 {
     Assert(this->segmentPageCount == allocator->maxAllocPageCount + allocator->secondaryAllocPageCount);
 
@@ -226,6 +258,9 @@ PageSegmentBase<T>::PageSegmentBase(PageAllocatorBase<T> * allocator, bool commi
         }
 
         Assert(this->GetCountOfFreePages() == this->freePageCount);
+
+        // Pages that are never committed can't be reset, so only fully committed segments qualify
+        this->lazyDecommit = this->CanLazyDecommit();
     }
     else
     {
@@ -246,20 +281,53 @@ PageSegmentBase<T>::PageSegmentBase(PageAllocatorBase<T> * allocator, bool commi
 
 template<typename T>
 PageSegmentBase<T>::PageSegmentBase(PageAllocatorBase<T> * allocator, void* address, uint pageCount, uint committedCount, bool enableWriteBarrier) :
-    SegmentBase<T>(allocator, allocator->maxAllocPageCount, enableWriteBarrier), decommitPageCount(0), freePageCount(0)
+    SegmentBase<T>(allocator, allocator->maxAllocPageCount, enableWriteBarrier), decommitPageCount(0), freePageCount(0), lazyDecommit(false)
 {
     this->address = (char*)address;
     this->segmentPageCount = pageCount;
 }
 
-#ifdef PAGEALLOCATOR_PROTECT_FREEPAGE
+template<typename T>
+PageSegmentBase<T>::~PageSegmentBase()
+{
+    // The reset pages go away with the segment
+    if (this->address != nullptr && this->lazyDecommit && this->decommitPageCount != 0)
+    {
+        this->GetAllocator()->ReportResetReleased(this->decommitPageCount * AutoSystemInfo::PageSize);
+    }
+
+    // Only whole, fully committed segments go to the PageSegmentCache
+    if (this->address == nullptr || !this->IsEmpty() || !PageSegmentCache::IsEnabled() ||
+        !this->CanUsePageSegmentCache(MEM_COMMIT | this->GetAllocator()->allocFlags, this->leadingGuardPageCount + this->trailingGuardPageCount != 0))
+    {
+        return;
+    }
+
+    // Segments in the cache must look freshly committed. Free pages are only zeroed already
+    // in release builds of zeroing page allocators, see FillFreePages.
+#if DBG
+    bool isZeroed = false;
+#else
+    bool isZeroed = this->GetAllocator()->ZeroPages();
+#ifdef RECYCLER_MEMORY_VERIFY
+    isZeroed = isZeroed && !this->GetAllocator()->verifyEnabled;
+#endif
+#endif
+    if (!isZeroed)
+    {
+        memset(this->address, 0, this->GetAvailablePageCount() * AutoSystemInfo::PageSize);
+    }
+    this->releaseToPageSegmentCache = true;
+}
+
 template<typename T>
 bool
 PageSegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
 {
     Assert(freePageCount + this->GetAllocator()->secondaryAllocPageCount == this->segmentPageCount || freePageCount == 0);
-    if (__super::Initialize(allocFlags, excludeGuardPages))
+    if (Base::Initialize(allocFlags, excludeGuardPages))
     {
+#ifdef PAGEALLOCATOR_PROTECT_FREEPAGE
         if (freePageCount != 0)
         {
             if (this->GetAllocator()->processHandle == GetCurrentProcess())
@@ -274,11 +342,11 @@ PageSegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
                 Assert(oldProtect == PAGE_READWRITE);
             }
         }
+#endif
         return true;
     }
     return false;
 }
-#endif
 
 template<typename T>
 void
@@ -432,7 +500,18 @@ PageSegmentBase<TVirtualAlloc>::AllocDecommitPages(uint pageCount, T freePages,
                 }
             }
 
-            void * ret = this->GetAllocator()->GetVirtualAllocator()->Alloc(pages, pageCount * AutoSystemInfo::PageSize, MEM_COMMIT, PAGE_READWRITE, this->IsInCustomHeapAllocator());
+            void * ret;
+            if (this->lazyDecommit)
+            {
+                // Reset pages are still committed, but may still hold their old content
+                memset(pages, 0, pageCount * AutoSystemInfo::PageSize);
+                ret = pages;
+            }
+            else
+            {
+                ret = this->GetAllocator()->GetVirtualAllocator()->Alloc(pages, pageCount * AutoSystemInfo::PageSize, MEM_COMMIT, PAGE_READWRITE, this->IsInCustomHeapAllocator());
+            }
+
             if (ret != nullptr)
             {
                 Assert(ret == pages);
@@ -441,8 +520,13 @@ PageSegmentBase<TVirtualAlloc>::AllocDecommitPages(uint pageCount, T freePages,
                 this->ClearRangeInDecommitPagesBitVector(index, pageCount);
 
                 uint newFreePageCount = this->GetCountOfFreePages();
+                uint recommitPageCount = pageCount - (oldFreePageCount - newFreePageCount);
                 freePageCount = freePageCount - oldFreePageCount + newFreePageCount;
-                decommitPageCount -= pageCount - (oldFreePageCount - newFreePageCount);
+                decommitPageCount -= recommitPageCount;
+                if (this->lazyDecommit)
+                {
+                    this->GetAllocator()->ReportResetReleased(recommitPageCount * AutoSystemInfo::PageSize);
+                }
 
                 Assert(freePageCount == (uint)this->GetCountOfFreePages());
                 Assert(decommitPageCount == (uint)this->GetCountOfDecommitPages());
@@ -556,9 +640,12 @@ PageSegmentBase<T>::DecommitPages(__in void * address, uint pageCount)
 
     if (!onlyUpdateState)
     {
-#pragma warning(suppress: 6250)
-        this->GetAllocator()->GetVirtualAllocator()->Free(address,
-          pageCount * AutoSystemInfo::PageSize, MEM_DECOMMIT);
+        this->DecommitMemory(address, pageCount);
+    }
+    else
+    {
+        // The caller really decommitted the pages, they would have to be committed again
+        Assert(!this->lazyDecommit);
     }
 
     Assert(decommitPageCount == (uint)this->GetCountOfDecommitPages());
@@ -573,11 +660,47 @@ PageSegmentBase<T>::DecommitFreePagesInternal(uint index, uint pageCount)
     this->SetRangeInDecommitPagesBitVector(index, pageCount);
 
     char * currentAddress = this->address + (index * AutoSystemInfo::PageSize);
+    this->DecommitMemory(currentAddress, pageCount);
+}
+
+template<typename T>
+void
+PageSegmentBase<T>::DecommitMemory(__in void * address, uint pageCount)
+{
+    if (this->lazyDecommit)
+    {
+        // Let the OS take the pages back when it needs them (madvise on Linux) instead of
+        // unmapping them. That is a lot cheaper than a decommit in the PAL, and allocating
+        // them again doesn't need a commit.
+        // If that fails, the pages just stay resident. They must not be decommitted, since
+        // allocating them again assumes they are committed.
+        void * ret = this->GetAllocator()->GetVirtualAllocator()->Alloc(address,
+          pageCount * AutoSystemInfo::PageSize, MEM_RESET, PAGE_READWRITE, false);
+        Assert(ret == nullptr || ret == address);
+        this->GetAllocator()->ReportReset(pageCount * AutoSystemInfo::PageSize);
+        return;
+    }
+
 #pragma warning(suppress: 6250)
-    this->GetAllocator()->GetVirtualAllocator()->Free(currentAddress,
+    this->GetAllocator()->GetVirtualAllocator()->Free(address,
       pageCount * AutoSystemInfo::PageSize, MEM_DECOMMIT);
 }
 
+template<typename T>
+bool
+PageSegmentBase<T>::CanLazyDecommit() const
+{
+#ifdef PAGEALLOCATOR_PROTECT_FREEPAGE
+    // Free pages are protected, and recommitting is what makes them accessible again
+    return false;
+#else
+    return CONFIG_FLAG(LazyDecommit)
+        && !this->IsInCustomHeapAllocator()
+        && this->GetAllocator()->GetAllocatorType() == PageAllocatorBaseCommon::AllocatorType::VirtualAlloc
+        && this->GetAllocator()->processHandle == GetCurrentProcess();
+#endif
+}
+
 template<typename T>
 size_t
 PageSegmentBase<T>::DecommitFreePages(size_t pageToDecommit)
@@ -680,6 +803,10 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(Allo
     minFreePageCount(0),
     isUsed(false),
     idleDecommitEnterCount(1),
+    arenaBlockCache(nullptr),
+    arenaBlockCachePageCount(0),
+    arenaBlockCacheHitCount(0),
+    arenaBlockCacheMissCount(0),
     isClosed(false),
     stopAllocationOnOutOfMemory(stopAllocationOnOutOfMemory),
     disableAllocationOutOfMemory(false),
@@ -1513,6 +1640,99 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReleaseAllocationNoSus
     this->Release((char *)allocation, allocation->pageCount, allocation->segment);
 }
 
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+PageAllocation *
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::AllocArenaBlockForBytes(size_t requestBytes)
+{
+    Assert(!isClosed);
+    ASSERT_THREAD();
+
+    uint pageSize = AutoSystemInfo::PageSize;
+    uint addSize = sizeof(PageAllocation) + pageSize - 1;   // this shouldn't overflow
+    // overflow check
+    size_t allocSize = AllocSizeMath::Add(requestBytes, addSize);
+    if (allocSize == (size_t)-1)
+    {
+        return nullptr;
+    }
+
+    size_t pages = allocSize / pageSize;
+
+    PageAllocation ** prev = &this->arenaBlockCache;
+    for (PageAllocation * allocation = *prev; allocation != nullptr; allocation = *prev)
+    {
+        // Don't hand out a block much bigger than asked for, the arena would only use the start of it
+        if (allocation->GetPageCount() >= pages && allocation->GetPageCount() / 2 <= pages)
+        {
+            *prev = *GetNextCachedArenaBlock(allocation);
+            this->arenaBlockCachePageCount -= allocation->GetPageCount();
+            this->arenaBlockCacheHitCount++;
+            return allocation;
+        }
+        prev = GetNextCachedArenaBlock(allocation);
+    }
+
+    this->arenaBlockCacheMissCount++;
+    PageAllocation * allocation = this->AllocAllocation(pages);
+    if (allocation == nullptr && this->arenaBlockCache != nullptr)
+    {
+        // The cached blocks didn't fit, give their pages back and try again
+        this->ReleaseArenaBlockCache();
+        allocation = this->AllocAllocation(pages);
+    }
+    return allocation;
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReleaseArenaBlockNoSuspend(PageAllocation * allocation)
+{
+    ASSERT_THREAD();
+
+    size_t maxCachePageCount = (size_t)this->pageAllocatorFlagTable.ArenaBlockCacheMaxSize * 1024 / AutoSystemInfo::PageSize;
+    bool canCache = !this->isClosed
+        && !this->zeroPages     // Cached blocks keep their contents
+#if defined(RECYCLER_NO_PAGE_REUSE) || defined(ARENA_MEMORY_VERIFY)
+        && !this->IsPageReuseDisabled()
+#endif
+        && this->arenaBlockCachePageCount + allocation->GetPageCount() <= maxCachePageCount;
+
+    if (!canCache)
+    {
+        this->ReleaseAllocationNoSuspend(allocation);
+        return;
+    }
+
+    *GetNextCachedArenaBlock(allocation) = this->arenaBlockCache;
+    this->arenaBlockCache = allocation;
+    this->arenaBlockCachePageCount += allocation->GetPageCount();
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReleaseArenaBlockCache()
+{
+    ASSERT_THREAD();
+
+    if (this->arenaBlockCache == nullptr)
+    {
+        return;
+    }
+
+    SuspendIdleDecommit();
+    PageAllocation * allocation = this->arenaBlockCache;
+    while (allocation != nullptr)
+    {
+        PageAllocation * next = *GetNextCachedArenaBlock(allocation);
+        this->ReleaseAllocationNoSuspend(allocation);
+        allocation = next;
+    }
+    ResumeIdleDecommit();
+
+    this->arenaBlockCache = nullptr;
+    this->arenaBlockCachePageCount = 0;
+}
+
 template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
 void
 PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::Release(void * address, size_t pageCount, void * segmentParam)
@@ -2431,6 +2651,8 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::DumpStats() const
 
     Output::Print(_u("  Free/Decommit/Min Free Pages              : %4d %4d %4d\n"),
         this->freePageCount, this->decommitPageCount, this->minFreePageCount);
+    Output::Print(_u("  Arena Block Cache Hit/Miss/Pages          : %4d %4d %4d\n"),
+        this->arenaBlockCacheHitCount, this->arenaBlockCacheMissCount, this->arenaBlockCachePageCount);
 }
 #endif
 
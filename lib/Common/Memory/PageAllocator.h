@@ -168,6 +168,8 @@ public:
     }
 #endif
 
+    bool CanUsePageSegmentCache(DWORD allocFlags, bool addGuardPages) const;
+
     bool IsInSegment(void* address) const
     {
         void* start = static_cast<void*>(GetAddress());
@@ -211,6 +213,7 @@ protected:
 
     bool   isWriteBarrierAllowed : 1;
     bool   isWriteBarrierEnabled : 1;
+    bool   releaseToPageSegmentCache : 1;
 };
 
 /*
@@ -231,10 +234,18 @@ class PageSegmentBase : public SegmentBase<TVirtualAlloc>
 public:
     PageSegmentBase(PageAllocatorBase<TVirtualAlloc> * allocator, bool committed, bool allocated, bool enableWriteBarrier);
     PageSegmentBase(PageAllocatorBase<TVirtualAlloc> * allocator, void* address, uint pageCount, uint committedCount, bool enableWriteBarrier);
+    ~PageSegmentBase();
     // Maximum possible size of a PageSegment; may be smaller.
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    // Only sizes the page bit vectors. A segment has the allocator's maxAllocPageCount pages, which is only
+    // raised past 256 when huge pages are enabled at runtime, see RecyclerPageAllocator::EnableHugePages.
+    // Without them, the cost is 64 bytes per segment and four more words to scan in the page bit vectors.
+    static const uint MaxDataPageCount = 512;     // 2 MB
+#else
     static const uint MaxDataPageCount = 256;     // 1 MB
+#endif
     static const uint MaxGuardPageCount = 16;
-    static const uint MaxPageCount = MaxDataPageCount + MaxGuardPageCount;  // 272 Pages
+    static const uint MaxPageCount = MaxDataPageCount + MaxGuardPageCount;
 
     typedef BVStatic<MaxPageCount> PageBitVector;
 
@@ -246,9 +257,7 @@ public:
     }
 
     void Prime();
-#ifdef PAGEALLOCATOR_PROTECT_FREEPAGE
     bool Initialize(DWORD allocFlags, bool excludeGuardPages);
-#endif
     uint GetFreePageCount() const { return freePageCount; }
     uint GetDecommitPageCount() const { return decommitPageCount; }
 
@@ -346,6 +355,8 @@ public:
 //---------- Private members ---------------/
 private:
     void DecommitFreePagesInternal(uint index, uint pageCount);
+    void DecommitMemory(__in void * address, uint pageCount);
+    bool CanLazyDecommit() const;
 
     uint GetBitRangeBase(void* address) const
     {
@@ -358,6 +369,9 @@ private:
 
     uint     freePageCount;
     uint     decommitPageCount;
+
+    // Decommitted pages of this segment are only reset (see -LazyDecommit), so they are still committed
+    bool     lazyDecommit;
 };
 
 template<typename TVirtualAlloc = VirtualAllocWrapper>
@@ -661,6 +675,14 @@ public:
     void ReleaseAllocation(PageAllocation * allocation);
     void ReleaseAllocationNoSuspend(PageAllocation * allocation);
 
+    // Arena big blocks go through a cache of recently released allocations, so that the short-lived
+    // arenas on this allocator's thread get warm pages. The cache is bounded by -ArenaBlockCacheMaxSize.
+    PageAllocation * AllocArenaBlockForBytes(DECLSPEC_GUARD_OVERFLOW size_t requestedBytes);
+    void ReleaseArenaBlockNoSuspend(PageAllocation * allocation);
+    void ReleaseArenaBlockCache();
+    size_t GetArenaBlockCacheHitCount() const { return arenaBlockCacheHitCount; }
+    size_t GetArenaBlockCacheMissCount() const { return arenaBlockCacheMissCount; }
+
     char * Alloc(size_t * pageCount, TSegment ** segment);
 
     void Release(void * address, size_t pageCount, void * segment);
@@ -838,6 +860,17 @@ protected:
     size_t minFreePageCount;
     uint idleDecommitEnterCount;
 
+    // Arena block cache, linked through the first word of each allocation's data
+    PageAllocation * arenaBlockCache;
+    size_t arenaBlockCachePageCount;
+    size_t arenaBlockCacheHitCount;
+    size_t arenaBlockCacheMissCount;
+
+    static PageAllocation ** GetNextCachedArenaBlock(PageAllocation * allocation)
+    {
+        return (PageAllocation **)allocation->GetAddress();
+    }
+
     void UpdateMinFreePageCount();
     void ResetMinFreePageCount();
     void ClearMinFreePageCount();
@@ -962,6 +995,22 @@ private:
         }
     }
 
+    void ReportReset(size_t byteCount)
+    {
+        if (policyManager != nullptr)
+        {
+            policyManager->ReportReset(byteCount);
+        }
+    }
+
+    void ReportResetReleased(size_t byteCount)
+    {
+        if (policyManager != nullptr)
+        {
+            policyManager->ReportResetReleased(byteCount);
+        }
+    }
+
     template <typename T>
     void ReleaseSegmentList(DListBase<T> * segmentList);
 
@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+
+CriticalSection PageSegmentCache::cs;
+PageSegmentCache::DepotEntry * PageSegmentCache::depot = nullptr;
+size_t PageSegmentCache::depotPageCount = 0;
+
+size_t
+PageSegmentCache::GetMaxDepotPageCount()
+{
+    return ((size_t)CONFIG_FLAG(PageSegmentCacheMaxSize) * 1024) / AutoSystemInfo::PageSize;
+}
+
+char *
+PageSegmentCache::Get(size_t pageCount)
+{
+    AutoCriticalSection autoCS(&cs);
+    DepotEntry ** previous = &depot;
+    for (DepotEntry * entry = depot; entry != nullptr; entry = entry->next)
+    {
+        if (entry->pageCount == pageCount)
+        {
+            *previous = entry->next;
+            depotPageCount -= pageCount;
+
+            // Wipe the depot header so the segment is all zero again
+            memset(entry, 0, sizeof(DepotEntry));
+            return (char *)entry;
+        }
+        previous = &entry->next;
+    }
+    return nullptr;
+}
+
+bool
+PageSegmentCache::Put(__in char * address, size_t pageCount)
+{
+    Assert(((size_t)address % AutoSystemInfo::PageSize) == 0);
+
+    // Also covers the cache being turned off
+    if (pageCount > GetMaxDepotPageCount())
+    {
+        return false;
+    }
+
+    AutoCriticalSection autoCS(&cs);
+    if (depotPageCount + pageCount > GetMaxDepotPageCount())
+    {
+        return false;
+    }
+
+    DepotEntry * entry = (DepotEntry *)address;
+    entry->next = depot;
+    entry->pageCount = pageCount;
+    depot = entry;
+    depotPageCount += pageCount;
+    return true;
+}
+
+void
+PageSegmentCache::ReleaseAll()
+{
+    AutoCriticalSection autoCS(&cs);
+    while (depot != nullptr)
+    {
+        DepotEntry * entry = depot;
+        depot = entry->next;
+        depotPageCount -= entry->pageCount;
+        FreeSegment((char *)entry, entry->pageCount);
+    }
+    Assert(depotPageCount == 0);
+}
+
+void
+PageSegmentCache::FreeSegment(__in char * address, size_t pageCount)
+{
+    VirtualAllocWrapper::Instance.Free(address, pageCount * AutoSystemInfo::PageSize, MEM_RELEASE);
+}
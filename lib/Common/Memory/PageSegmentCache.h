@@ -0,0 +1,45 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+/*
+ * PageSegmentCache keeps the empty page segments that page allocators would otherwise release
+ * to the OS, so that a segment freed by one page allocator (e.g. another thread's recycler)
+ * can back a new segment in any other page allocator in the process without going through
+ * VirtualAlloc/VirtualFree (mmap/munmap on Linux) again.
+ *
+ * Segments are kept in a process-wide depot under a lock, so a segment released on any thread
+ * (including threads that go away without notice) is always counted against the cap. The depot
+ * is bounded by -PageSegmentCacheMaxSize; segments that don't fit are released to the OS.
+ *
+ * Only committed, read/write segments allocated with VirtualAllocWrapper and without guard
+ * pages are cached. Cached memory is always zeroed, just like freshly committed memory.
+ */
+class PageSegmentCache
+{
+public:
+    static bool IsEnabled() { return GetMaxDepotPageCount() != 0; }
+    static char * Get(size_t pageCount);
+    static bool Put(__in char * address, size_t pageCount);
+    static void ReleaseAll();
+
+private:
+    // Header written at the start of each segment while it sits in the depot
+    struct DepotEntry
+    {
+        DepotEntry * next;
+        size_t pageCount;
+    };
+
+    static size_t GetMaxDepotPageCount();
+    static void FreeSegment(__in char * address, size_t pageCount);
+
+    static CriticalSection cs;
+    static DepotEntry * depot;
+    static size_t depotPageCount;
+};
+}
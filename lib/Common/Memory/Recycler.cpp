@@ -129,13 +129,7 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     threadPageAllocator(pageAllocator),
     markPagePool(configFlagsTable),
-    parallelMarkPagePool1(configFlagsTable),
-    parallelMarkPagePool2(configFlagsTable),
-    parallelMarkPagePool3(configFlagsTable),
     markContext(this, &this->markPagePool),
-    parallelMarkContext1(this, &this->parallelMarkPagePool1),
-    parallelMarkContext2(this, &this->parallelMarkPagePool2),
-    parallelMarkContext3(this, &this->parallelMarkPagePool3),
 #if ENABLE_PARTIAL_GC
     clientTrackedObjectAllocator(_u("CTO-List"), GetPageAllocator(), Js::Throw::OutOfMemory),
 #endif
@@ -154,6 +148,7 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     mainThreadHandle(NULL),
 #if ENABLE_CONCURRENT_GC
     backgroundFinishMarkCount(0),
+    pauseBudget(configFlagsTable.GCPauseBudget),
     hasPendingUnpinnedObject(false),
     hasPendingConcurrentFindRoot(false),
     queueTrackedObject(false),
@@ -163,8 +158,14 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
-    parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
-    parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
+    maxParallelism(1),
+    parallelMarkContextCount(0),
+    parallelMarkContexts(nullptr),
+    parallelMarkActiveCount(0),
+    parallelSweepStartedEndIndex(0),
+    backgroundFinalizeThread(this, &Recycler::BackgroundFinalizeWorkFunc, 0),
+    enableBackgroundFinalize(configFlagsTable.RecyclerBackgroundFinalize),
+    backgroundFinalizeInProgress(false),
     priorityBoost(false),
     isAborting(false),
 #if DBG
@@ -205,8 +206,15 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     transientPinnedObject(nullptr),
     pinnedObjectMap(1024, HeapAllocator::GetNoMemProtectInstance()),
     weakReferenceMap(1024, HeapAllocator::GetNoMemProtectInstance()),
+    ephemeronTable(64, HeapAllocator::GetNoMemProtectInstance()),
     weakReferenceCleanupId(0),
     collectionWrapper(&DefaultRecyclerCollectionWrapper::Instance),
+    sizeHistogram(nullptr),
+    allocationSampleInterval(0),
+    allocationSampleGap(0),
+    bytesUntilAllocationSample(SIZE_MAX),
+    histogramBytesUntilAllocationSample(SIZE_MAX),
+    enablePretenuring(false),
     isScriptActive(false),
     isInScript(false),
     isShuttingDown(false),
@@ -262,9 +270,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
     markContext.SetMarkMap(markMap);
-    parallelMarkContext1.SetMarkMap(markMap);
-    parallelMarkContext2.SetMarkMap(markMap);
-    parallelMarkContext3.SetMarkMap(markMap);
 #endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
@@ -339,9 +344,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     // recycler requires at least Recycler::PrimaryMarkStackReservedPageCount to function properly for the main mark context
     this->markContext.SetMaxPageCount(max(static_cast<size_t>(GetRecyclerFlagsTable().MaxMarkStackPageCount), static_cast<size_t>(Recycler::PrimaryMarkStackReservedPageCount)));
-    this->parallelMarkContext1.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext2.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext3.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
 
     if (GetRecyclerFlagsTable().IsEnabled(Js::GCMemoryThresholdFlag))
     {
@@ -497,6 +499,26 @@ Recycler::~Recycler()
 
     ClearObjectBeforeCollectCallbacks();
 
+    if (this->enablePretenuring)
+    {
+        for (uint i = 0; i < HeapConstants::BucketCount; i++)
+        {
+            this->RemoveSmallAllocator(&this->pretenuredAllocators[i], (i + 1) << HeapConstants::ObjectAllocationShift);
+        }
+        this->enablePretenuring = false;
+    }
+
+    if (this->sizeHistogram != nullptr)
+    {
+        if (GetRecyclerFlagsTable().RecyclerSizeHistogram)
+        {
+            this->sizeHistogram->Print();
+        }
+        NoMemProtectHeapDelete(this->sizeHistogram);
+        this->sizeHistogram = nullptr;
+        this->bytesUntilAllocationSample = this->histogramBytesUntilAllocationSample;
+    }
+
 #ifdef RECYCLER_DUMP_OBJECT_GRAPH
     if (GetRecyclerFlagsTable().DumpObjectGraphOnExit)
     {
@@ -543,9 +565,13 @@ Recycler::~Recycler()
 #endif
 
     markContext.Release();
-    parallelMarkContext1.Release();
-    parallelMarkContext2.Release();
-    parallelMarkContext3.Release();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->Release();
+    });
+#if ENABLE_CONCURRENT_GC
+    DeleteParallelMarkContexts();
+#endif
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -762,6 +788,10 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     this->skipStack = false;
 #endif
+    if (GetRecyclerFlagsTable().RecyclerSizeHistogram)
+    {
+        this->EnableSizeHistogram();
+    }
 
 #if ENABLE_PARTIAL_GC
 #if ENABLE_DEBUG_CONFIG_OPTIONS
@@ -841,6 +871,25 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
     }
 #endif
 
+    // Page heap and memory verification need every allocation to go through the normal path, and the
+    // pretenured allocators only handle the blocks of the write barrier mode we were built with
+    this->enablePretenuring = GetRecyclerFlagsTable().RecyclerPretenure && !IsPageHeapEnabled()
+#ifdef RECYCLER_MEMORY_VERIFY
+        && !this->VerifyEnabled()
+#endif
+#if GLOBAL_ENABLE_WRITE_BARRIER && defined(_WIN32)
+        && !CONFIG_FLAG(ForceSoftwareWriteBarrier)
+#endif
+        ;
+    if (this->enablePretenuring)
+    {
+        for (uint i = 0; i < HeapConstants::BucketCount; i++)
+        {
+            this->AddSmallAllocator(&this->pretenuredAllocators[i], (i + 1) << HeapConstants::ObjectAllocationShift);
+            this->pretenuredAllocators[i].SetIsPretenured();
+        }
+    }
+
 #ifdef RECYCLER_STRESS
 #if ENABLE_PARTIAL_GC
     if (GetRecyclerFlagsTable().RecyclerTrackStress)
@@ -866,8 +915,20 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
+    // Parallel mark uses one thread per physical processor, limited by the RecyclerMaxParallelism flag
+    // and by the number of ways the mark stack can be split.
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    uint parallelismLimit = MarkContext::MaxParallelism;
+    if (GetRecyclerFlagsTable().RecyclerMaxParallelism > 0)
+    {
+        parallelismLimit = min(parallelismLimit, (uint)GetRecyclerFlagsTable().RecyclerMaxParallelism);
+    }
+    this->maxParallelism = min(max(numProcs, 1u), parallelismLimit);
+    if (CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase))
+    {
+        // Make sure we mark at least 4-way parallel, even on machines with fewer processors
+        this->maxParallelism = min(max(this->maxParallelism, 4u), parallelismLimit);
+    }
 
     if (forceInThread)
     {
@@ -986,9 +1047,10 @@ Recycler::ClearNeedOOMRescan()
 {
     this->needOOMRescan = false;
     markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    });
 }
 
 bool
@@ -1098,6 +1160,32 @@ Recycler::Prime()
     });
 }
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+void
+Recycler::EnableHugePages()
+{
+    // The thread page allocator is shared with the thread context and keeps its segments
+    recyclerPageAllocator.EnableHugePages();
+    recyclerLargeBlockPageAllocator.EnableHugePages();
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
+    recyclerWithBarrierPageAllocator.EnableHugePages();
+#endif
+}
+#endif
+
+bool
+Recycler::QueueBackgroundFinalize(RecyclerBackgroundFinalizeCallback callback, void * data)
+{
+#if ENABLE_CONCURRENT_GC
+    // The finalizer thread needs the concurrent thread service, which goes away on shutdown
+    if (this->enableBackgroundFinalize && this->threadService != nullptr)
+    {
+        return this->pendingBackgroundFinalizeQueue.Add(callback, data);
+    }
+#endif
+    return false;
+}
+
 void
 Recycler::AddExternalMemoryUsage(size_t size)
 {
@@ -1376,8 +1464,13 @@ Recycler::TryLargeAlloc(HeapInfo * heap, size_t size, ObjectInfoBits attributes,
         return nullptr;
     }
 
+    // Objects above the threshold get a block of their own instead of sharing one with other large objects,
+    // so their pages go back as soon as they are swept instead of staying committed until the whole block is empty
+    size_t dedicatedSize = (size_t)this->GetRecyclerFlagsTable().RecyclerDedicatedLargeObjectSize;
+    bool dedicated = dedicatedSize != 0 && sizeCat >= dedicatedSize;
+
     char * memBlock;
-    if (heap->largeObjectBucket.largeBlockList != nullptr)
+    if (!dedicated && heap->largeObjectBucket.largeBlockList != nullptr)
     {
         memBlock = heap->largeObjectBucket.largeBlockList->Alloc(sizeCat, attributes);
         if (memBlock != nullptr)
@@ -1414,7 +1507,7 @@ Recycler::TryLargeAlloc(HeapInfo * heap, size_t size, ObjectInfoBits attributes,
     }
 #endif
 
-    LargeHeapBlock * heapBlock = heap->AddLargeHeapBlock(sizeCat);
+    LargeHeapBlock * heapBlock = heap->AddLargeHeapBlock(sizeCat, dedicated);
     if (heapBlock == nullptr)
     {
         return nullptr;
@@ -2057,6 +2150,11 @@ Recycler::ResetMarks(ResetMarkFlags flags)
     Assert(IsMarkStackEmpty());
     this->scanPinnedObjectMap = true;
     this->hasScannedInitialImplicitRoots = false;
+    {
+        // An abandoned background finish mark may still be collecting the sweep candidates
+        AutoCriticalSection lock(&this->weakReferenceMapCriticalSection);
+        this->weakReferenceMap.ClearSweepCandidates();
+    }
 
     heapBlockMap.ResetMarks();
 
@@ -2232,14 +2330,38 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 
     RECYCLER_PROFILE_EXEC_THREAD_BEGIN(background, this, Js::MarkPhase);
 
-    if (this->enableScanInteriorPointers)
-    {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
-    }
-    else
+#if ENABLE_CONCURRENT_GC
+    InterlockedIncrement(&this->parallelMarkActiveCount);
+#endif
+
+    // Once our own mark stack is drained, keep marking with work stolen from the other mark contexts
+    do
     {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+#ifdef RECYCLER_STATS
+        LARGE_INTEGER markStartTime;
+        QueryPerformanceCounter(&markStartTime);
+#endif
+
+        if (this->enableScanInteriorPointers)
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
+        }
+        else
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        }
+
+#if defined(RECYCLER_STATS) && ENABLE_CONCURRENT_GC
+        LARGE_INTEGER markEndTime;
+        QueryPerformanceCounter(&markEndTime);
+        this->collectionStats.parallelMarkTime[GetParallelMarkContextIndex(markContext)] += markEndTime.QuadPart - markStartTime.QuadPart;
+#endif
     }
+#if ENABLE_CONCURRENT_GC
+    while (this->StealParallelMarkWork(markContext));
+#else
+    while (false);
+#endif
 
     RECYCLER_PROFILE_EXEC_THREAD_END(background, this, Js::MarkPhase);
 
@@ -2334,9 +2456,12 @@ Recycler::ResetMarkCollectionState()
 
     // If we aborted after doing a background parallel Mark, we wouldn't have cleaned up the
     // parallel markContexts yet. Clean these up now.
-    // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    // Note parallelMarkContexts[0] is not used in background parallel (see DoBackgroundParallelMark),
+    // and it is already clean.
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->Cleanup();
+    });
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2415,7 +2540,7 @@ Recycler::RescanMark(DWORD waitTime)
         // Only do background finish mark if we have a time limit or it is forced
         (CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::BackgroundFinishMarkPhase) || waitTime != INFINITE) &&
         // Don't do background finish mark if we failed to finish mark too many times
-        (this->backgroundFinishMarkCount < RecyclerHeuristic::MaxBackgroundFinishMarkCount(this->GetRecyclerFlagsTable())))
+        (this->backgroundFinishMarkCount < RecyclerHeuristic::MaxBackgroundFinishMarkCount(this->pauseBudget, this->GetRecyclerFlagsTable())))
     {
         this->PrepareBackgroundFindRoots();
         if (StartConcurrent(CollectionStateConcurrentFinishMark))
@@ -2504,14 +2629,18 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->parallelMarkContextCount == this->maxParallelism - 1);
 
     // Split the mark stack into [this->maxParallelism] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
-    uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
+    MarkContext * splitContexts[MarkContext::MaxSplitTargets];
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        splitContexts[i] = &this->parallelMarkContexts[i]->markContext;
+    }
+    uint actualSplitCount = markContext.Split(this->parallelMarkContextCount, splitContexts);
 
-    Assert(actualSplitCount <= 3);
+    Assert(actualSplitCount <= this->parallelMarkContextCount);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2529,24 +2658,22 @@ Recycler::DoParallelMark()
         StartQueueTrackedObject();
     }
 
+    this->SetParallelMarkWorkStealing(true);
+
     // Kick off marking on the background thread
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
 
     // If there's enough work to split, then kick off marking on parallel threads too.
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    if (concurrentSuccess && actualSplitCount >= 2)
+    // parallelMarkContexts[0] is ours, so the parallel threads take the remaining splits.
+    uint startedEndIndex = 1;
+    if (concurrentSuccess)
     {
-        parallelSuccess1 = parallelThread1.StartConcurrent();
-        if (parallelSuccess1 && actualSplitCount == 3)
-        {
-            parallelSuccess2 = parallelThread2.StartConcurrent();
-        }
+        startedEndIndex = this->StartParallelThreads(1, actualSplitCount);
     }
 
     // Process our portion of the split.
-    this->ProcessParallelMark(false, &parallelMarkContext1);
+    this->ProcessParallelMark(false, &parallelMarkContexts[0]->markContext);
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
@@ -2559,29 +2686,9 @@ Recycler::DoParallelMark()
         this->ProcessParallelMark(false, &markContext);
     }
 
-    if (actualSplitCount >= 2)
-    {
-        if (parallelSuccess1)
-        {
-            parallelThread1.WaitForConcurrent();
-        }
-        else
-        {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
-        }
+    this->FinishParallelMark(false, 1, actualSplitCount, startedEndIndex);
 
-        if (actualSplitCount == 3)
-        {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
-        }
-    }
+    this->SetParallelMarkWorkStealing(false);
 
     this->collectionState = CollectionStateMark;
 
@@ -2608,19 +2715,24 @@ Recycler::DoBackgroundParallelMark()
 {
     // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
+    // We are running on the concurrent thread, which processes the main markContext, so
+    // parallelMarkContexts[0] (the main thread's portion during in-thread parallel mark) is not used.
     uint actualSplitCount = 0;
-    MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[MarkContext::MaxSplitTargets];
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->parallelMarkContextCount == this->maxParallelism - 1);
         if (this->maxParallelism > 2)
         {
+            for (uint i = 1; i < this->parallelMarkContextCount; i++)
+            {
+                splitContexts[i - 1] = &this->parallelMarkContexts[i]->markContext;
+            }
             actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
         }
     }
 
-    Assert(actualSplitCount <= 2);
+    Assert(actualSplitCount + 1 <= this->maxParallelism - 1);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2638,43 +2750,297 @@ Recycler::DoBackgroundParallelMark()
 
     this->collectionState = CollectionStateBackgroundParallelMark;
 
+    this->SetParallelMarkWorkStealing(true);
+
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    parallelSuccess1 = parallelThread1.StartConcurrent();
-    if (parallelSuccess1 && actualSplitCount == 2)
-    {
-        parallelSuccess2 = parallelThread2.StartConcurrent();
-    }
+    uint startedEndIndex = this->StartParallelThreads(1, actualSplitCount + 1);
 
     // Process our portion of the split.
     this->ProcessParallelMark(true, &markContext);
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
-    if (parallelSuccess1)
+    this->FinishParallelMark(true, 1, actualSplitCount + 1, startedEndIndex);
+
+    this->SetParallelMarkWorkStealing(false);
+
+    this->collectionState = CollectionStateConcurrentMark;
+}
+
+uint
+Recycler::StartParallelThreads(uint startIndex, uint endIndex)
+{
+    // Start the parallel threads for parallelMarkContexts[startIndex, endIndex) in order,
+    // stopping at the first one that fails to start.
+    // Returns the end of the range of threads that were started.
+    Assert(startIndex > 0 && endIndex <= this->parallelMarkContextCount);
+
+    uint index = startIndex;
+    while (index < endIndex && this->parallelMarkContexts[index]->parallelThread.StartConcurrent())
     {
-        parallelThread1.WaitForConcurrent();
+        index++;
     }
-    else
+    return index;
+}
+
+void
+Recycler::FinishParallelMark(bool background, uint startIndex, uint endIndex, uint startedEndIndex)
+{
+    Assert(startIndex <= startedEndIndex && startedEndIndex <= endIndex);
+
+    // Process the splits whose threads we failed to start in-thread first,
+    // so that we are doing useful work while the started threads are still running.
+    for (uint i = startedEndIndex; i < endIndex; i++)
+    {
+        this->ProcessParallelMark(background, &this->parallelMarkContexts[i]->markContext);
+    }
+
+    for (uint i = startIndex; i < startedEndIndex; i++)
+    {
+        this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
+    }
+}
+
+void
+Recycler::SetParallelMarkWorkStealing(bool enable)
+{
+    // Only set or cleared when no thread is marking, and all the mark stacks are drained when it is cleared.
+    Assert(this->parallelMarkActiveCount == 0);
+    Assert(enable || (this->markStealDeque.IsEmpty() && !this->HasPendingMarkObjects()));
+
+    this->markContext.SetStealDeque(enable ? &this->markStealDeque : nullptr);
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        ParallelMarkContext * parallelMarkContext = this->parallelMarkContexts[i];
+        parallelMarkContext->markContext.SetStealDeque(enable ? &parallelMarkContext->stealDeque : nullptr);
+    }
+}
+
+bool
+Recycler::StealParallelMarkWork(MarkContext * markContext)
+{
+    // Our mark stack is drained. Steal a chunk of work published by another mark context.
+    // The other contexts may publish more work for as long as they are marking, so keep trying
+    // until they are all done.
+    InterlockedDecrement(&this->parallelMarkActiveCount);
+
+    if (markContext->GetPageAllocator()->DisableAllocationOutOfMemory())
     {
-        this->ProcessParallelMark(true, &parallelMarkContext2);
+        // We ran out of mark stack pages, which will be dealt with by an OOM rescan anyway
+        return false;
     }
 
-    if (actualSplitCount == 2)
+    while (true)
     {
-        if (parallelSuccess2)
+        if (markContext != &this->markContext && markContext->StealMarkWork(&this->markStealDeque))
         {
-            parallelThread2.WaitForConcurrent();
+            break;
         }
-        else
+
+        bool stolen = false;
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            ParallelMarkContext * victim = this->parallelMarkContexts[i];
+            if (&victim->markContext != markContext && markContext->StealMarkWork(&victim->stealDeque))
+            {
+                stolen = true;
+                break;
+            }
+        }
+
+        if (stolen)
+        {
+            break;
+        }
+
+        if (this->parallelMarkActiveCount == 0)
         {
-            this->ProcessParallelMark(true, &parallelMarkContext3);
+            return false;
         }
+
+        YieldProcessor();
     }
 
-    this->collectionState = CollectionStateConcurrentMark;
+    InterlockedIncrement(&this->parallelMarkActiveCount);
+    RECYCLER_STATS_INTERLOCKED_INC(this, parallelMarkStealCount);
+    return true;
+}
+
+#ifdef RECYCLER_STATS
+uint
+Recycler::GetParallelMarkContextIndex(MarkContext * markContext) const
+{
+    if (markContext == &this->markContext)
+    {
+        return 0;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (markContext == &this->parallelMarkContexts[i]->markContext)
+        {
+            return i + 1;
+        }
+    }
+
+    Assert(false);
+    return 0;
+}
+#endif
+
+bool
+Recycler::StartParallelSweep()
+{
+    // The parallel mark threads are idle during background sweep, so they can help sweep the heap buckets
+    Assert(this->collectionState == CollectionStateConcurrentSweep);
+
+    if (!this->enableParallelMark || !GetRecyclerFlagsTable().RecyclerParallelSweep)
+    {
+        return false;
+    }
+
+#if ENABLE_PARTIAL_GC
+    // The partial collect heuristics are accumulated in the RecyclerSweep as the heap blocks are swept
+    if (this->inPartialCollectMode)
+    {
+        return false;
+    }
+#endif
+
+    // Don't sweep in parallel when freed objects are reported to diagnostics that aren't thread safe
+    if (this->ForceSweepObject() || RecyclerMemoryTracking::IsActive())
+    {
+        return false;
+    }
+#ifdef ENABLE_JS_ETW
+    if (EventEnabledJSCRIPT_RECYCLER_FREE_MEMORY())
+    {
+        return false;
+    }
+#endif
+
+    this->parallelSweepStartedEndIndex = this->StartParallelThreads(1, this->parallelMarkContextCount);
+    return this->parallelSweepStartedEndIndex > 1;
+}
+
+void
+Recycler::FinishParallelSweep()
+{
+    for (uint i = 1; i < this->parallelSweepStartedEndIndex; i++)
+    {
+        this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
+    }
+    this->parallelSweepStartedEndIndex = 0;
+}
+
+void
+Recycler::StartBackgroundFinalize()
+{
+    if (this->pendingBackgroundFinalizeQueue.IsEmpty())
+    {
+        return;
+    }
+
+    if (this->backgroundFinalizeInProgress)
+    {
+        if (!this->backgroundFinalizeThread.TryWaitForConcurrent())
+        {
+            // Still running the previous batch, the pending callbacks go with the next one
+            return;
+        }
+        this->backgroundFinalizeInProgress = false;
+    }
+
+    Assert(this->backgroundFinalizeQueue.IsEmpty());
+    this->backgroundFinalizeQueue.Swap(&this->pendingBackgroundFinalizeQueue);
+
+    if (this->backgroundFinalizeThread.StartConcurrent())
+    {
+        this->backgroundFinalizeInProgress = true;
+    }
+    else
+    {
+        this->backgroundFinalizeQueue.Run();
+    }
+}
+
+void
+Recycler::FinishBackgroundFinalize()
+{
+    if (this->backgroundFinalizeInProgress)
+    {
+        this->backgroundFinalizeThread.WaitForConcurrent();
+        this->backgroundFinalizeInProgress = false;
+    }
+
+    Assert(this->backgroundFinalizeQueue.IsEmpty());
+    this->pendingBackgroundFinalizeQueue.Run();
+}
+
+void
+Recycler::BackgroundFinalizeWorkFunc(uint parallelId)
+{
+    Assert(parallelId == 0);
+    this->backgroundFinalizeQueue.Run();
+}
+
+bool
+Recycler::InitializeParallelMarkContexts()
+{
+    if (this->parallelMarkContexts != nullptr)
+    {
+        return true;
+    }
+
+    Assert(this->maxParallelism > 1 && this->maxParallelism - 1 <= MarkContext::MaxSplitTargets);
+    const uint contextCount = this->maxParallelism - 1;
+
+    ParallelMarkContext ** contexts = HeapNewNoThrowArrayZ(ParallelMarkContext *, contextCount);
+    if (contexts == nullptr)
+    {
+        return false;
+    }
+
+    this->parallelMarkContexts = contexts;
+    while (this->parallelMarkContextCount < contextCount)
+    {
+        ParallelMarkContext * context = HeapNewNoThrow(ParallelMarkContext, this, this->parallelMarkContextCount);
+        if (context == nullptr)
+        {
+            this->DeleteParallelMarkContexts();
+            return false;
+        }
+
+#ifdef RECYCLER_MARK_TRACK
+        context->markContext.SetMarkMap(this->markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        context->markContext.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
+#endif
+        contexts[this->parallelMarkContextCount++] = context;
+    }
+
+    return true;
+}
+
+void
+Recycler::DeleteParallelMarkContexts()
+{
+    if (this->parallelMarkContexts == nullptr)
+    {
+        Assert(this->parallelMarkContextCount == 0);
+        return;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        HeapDelete(this->parallelMarkContexts[i]);
+    }
+
+    HeapDeleteArray(this->maxParallelism - 1, this->parallelMarkContexts);
+    this->parallelMarkContexts = nullptr;
+    this->parallelMarkContextCount = 0;
 }
 #endif
 
@@ -2762,6 +3128,39 @@ Recycler::EndMarkCheckOOMRescan()
     return oomRescan;
 }
 
+bool
+Recycler::EndMarkEphemerons()
+{
+    // The ephemeron table isn't scanned for roots, so mark the values of the entries that survive
+    // now that we know which owners and keys do.
+    const auto isMarked = [this](void * object) { return this->IsObjectMarked(object); };
+    const auto markValue = [this](void * value) { this->TryMarkNonInterior(value); };
+    const auto onScanObject = [&](void * object) { this->ephemeronTable.OnObjectMarked(object, isMarked, markValue); };
+
+    bool oomRescan = false;
+    bool markedValue = this->ephemeronTable.BeginMarkValues(isMarked, markValue);
+    while (markedValue)
+    {
+        // Every object traced from the values wakes the entries waiting on it
+        if (this->enableScanInteriorPointers)
+        {
+            this->markContext.ProcessMark</* parallel */ false, /* interior */ true>(onScanObject);
+        }
+        else
+        {
+            this->markContext.ProcessMark</* parallel */ false, /* interior */ false>(onScanObject);
+        }
+        DebugOnly(this->markContext.VerifyPostMarkState());
+
+        // Recovering from running out of mark stack rescans the heap, which can mark more owners and keys
+        oomRescan |= EndMarkCheckOOMRescan();
+
+        // Pick up the entries of the objects that were marked without being scanned here
+        markedValue = this->ephemeronTable.MarkWaitingValues(isMarked, markValue);
+    }
+    return oomRescan;
+}
+
 bool
 Recycler::EndMark()
 {
@@ -2779,11 +3178,15 @@ Recycler::EndMark()
     }
 
     bool oomRescan = EndMarkCheckOOMRescan();
+    oomRescan |= EndMarkEphemerons();
 
     if (ProcessObjectBeforeCollectCallbacks())
     {
         // callbacks may trigger additional marking, need to check OOMRescan again
         oomRescan |= EndMarkCheckOOMRescan();
+
+        // and the objects they revive may be ephemeron owners or keys
+        oomRescan |= EndMarkEphemerons();
     }
 
     // GC-CONSIDER: Consider keeping some page around
@@ -2792,15 +3195,17 @@ Recycler::EndMark()
     // Clean up mark contexts, which will release held free pages
     // Do this for all contexts before we decommit, to make sure all pages are freed
     markContext.Cleanup();
-    parallelMarkContext1.Cleanup();
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->Cleanup();
+    });
 
     // Decommit all pages
     markContext.DecommitPages();
-    parallelMarkContext1.DecommitPages();
-    parallelMarkContext2.DecommitPages();
-    parallelMarkContext3.DecommitPages();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->DecommitPages();
+    });
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2820,6 +3225,7 @@ Recycler::EndMarkOnLowMemory()
     // Try to release as much memory as possible
     ForEachPageAllocator([](IdleDecommitPageAllocator* pageAlloc)
     {
+        pageAlloc->ReleaseArenaBlockCache();
         pageAlloc->DecommitNow();
     });
 
@@ -2890,9 +3296,12 @@ Recycler::EndMarkOnLowMemory()
     while (this->NeedOOMRescan());
 
     Assert(!markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+#if DBG
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        Assert(!parallelMarkContext->GetPageAllocator()->DisableAllocationOutOfMemory());
+    });
+#endif
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2917,7 +3326,12 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    bool isEmpty = markContext.IsEmpty();
+    ForEachParallelMarkContext([&](MarkContext * parallelMarkContext)
+    {
+        isEmpty = parallelMarkContext->IsEmpty() && isEmpty;
+    });
+    return isEmpty;
 }
 #endif
 
@@ -3051,6 +3465,16 @@ Recycler::Sweep(bool concurrent)
                     }
                     RECYCLER_PROFILE_EXEC_END(this, Js::ResetWriteWatchPhase);
                 }
+#endif
+#ifdef RECYCLER_WRITE_BARRIER
+#ifdef RECYCLER_WRITE_WATCH
+                if (CONFIG_FLAG(ForceSoftwareWriteBarrier))
+#endif
+                {
+                    RECYCLER_PROFILE_EXEC_BEGIN(this, Js::ResetWriteWatchPhase);
+                    heapBlockMap.ResetWriteBarrierDirtyPages(this);
+                    RECYCLER_PROFILE_EXEC_END(this, Js::ResetWriteWatchPhase);
+                }
 #endif
             }
 #endif
@@ -3111,9 +3535,8 @@ Recycler::SweepWeakReference()
     RECYCLER_PROFILE_EXEC_BEGIN(this, Js::SweepWeakPhase);
     GCETW(GC_SWEEP_WEAKREF_START, (this));
 
-    // REVIEW: Clean up the weak reference map concurrently?
     bool hasCleanup = false;
-    weakReferenceMap.Map([&hasCleanup](RecyclerWeakReferenceBase * weakRef) -> bool
+    auto sweepWeakReference = [&hasCleanup](RecyclerWeakReferenceBase * weakRef) -> bool
     {
         if (!weakRef->weakRefHeapBlock->TestObjectMarkedBit(weakRef))
         {
@@ -3137,7 +3560,22 @@ Recycler::SweepWeakReference()
 
         // Keep
         return true;
-    });
+    };
+
+    if (weakReferenceMap.HasSweepCandidates())
+    {
+        // The background finish mark already found the entries that survive, only look at the rest
+        weakReferenceMap.MapSweepCandidates(sweepWeakReference);
+    }
+    else
+    {
+        weakReferenceMap.Map(sweepWeakReference);
+    }
+
+    if (this->ephemeronTable.Sweep([this](void * object) { return this->IsObjectMarked(object); }) != 0)
+    {
+        hasCleanup = true;
+    }
     this->weakReferenceCleanupId += hasCleanup;
 
     GCETW(GC_SWEEP_WEAKREF_STOP, (this));
@@ -3199,6 +3637,11 @@ Recycler::SweepHeap(bool concurrent, RecyclerSweep& recyclerSweep)
     recyclerPageAllocator.ResumeIdleDecommit();
     recyclerLargeBlockPageAllocator.ResumeIdleDecommit();
 
+#if ENABLE_CONCURRENT_GC
+    // Finalizable objects are always swept in-thread, so whatever they queued is ready to go
+    this->StartBackgroundFinalize();
+#endif
+
 #if ENABLE_CONCURRENT_GC
     if (concurrent)
     {
@@ -3320,6 +3763,10 @@ Recycler::DisposeObjects()
 
     this->inDispose = false;
 
+#if ENABLE_CONCURRENT_GC
+    this->StartBackgroundFinalize();
+#endif
+
     ASYNC_HOST_OPERATION_END(collectionWrapper);
 
     uint sweptBytes = 0;
@@ -3742,7 +4189,11 @@ Recycler::DoCollectWrapped(CollectionFlags flags)
 #endif
 
     this->allowDispose = (flags & CollectOverride_AllowDispose) == CollectOverride_AllowDispose;
+
+    LARGE_INTEGER pauseStartTime;
+    QueryPerformanceCounter(&pauseStartTime);
     BOOL collected = collectionWrapper->ExecuteRecyclerCollectionFunction(this, &Recycler::DoCollect, flags);
+    this->RecordPause(pauseStartTime);
 
 #if ENABLE_CONCURRENT_GC
     Assert(IsConcurrentExecutingState() || IsConcurrentFinishedState() || !CollectionInProgress());
@@ -4344,9 +4795,10 @@ Recycler::ProcessTrackedObjects()
 
     // If we did a parallel mark, we need to process any queued tracked objects from the parallel mark stack as well.
     // If we didn't, this will do nothing.
-    parallelMarkContext1.ProcessTracked();
-    parallelMarkContext2.ProcessTracked();
-    parallelMarkContext3.ProcessTracked();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->ProcessTracked();
+    });
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4849,8 +5301,15 @@ Recycler::FinalizeConcurrent(bool restoreState)
 
     // Shutdown parallel threads and return the handle for them so the caller can
     // close it.
-    parallelThread1.Shutdown();
-    parallelThread2.Shutdown();
+    for (uint i = 1; i < this->parallelMarkContextCount; i++)
+    {
+        this->parallelMarkContexts[i]->parallelThread.Shutdown();
+    }
+
+    // Let the finalizer thread finish its batch, and run whatever is still queued in-thread.
+    // Nothing gets queued once the thread service is gone.
+    FinishBackgroundFinalize();
+    this->backgroundFinalizeThread.Shutdown();
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -4915,6 +5374,12 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
         this->enableParallelMark = false;
     }
 
+    if (this->enableParallelMark && !this->InitializeParallelMarkContexts())
+    {
+        // Couldn't allocate the parallel mark contexts, mark without parallelism instead
+        this->enableParallelMark = false;
+    }
+
     if (threadService->HasCallback())
     {
         this->threadService = threadService;
@@ -4923,31 +5388,22 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     else
     {
         bool startConcurrentThread = true;
-        bool startedParallelThread1 = false;
-        bool startedParallelThread2 = false;
+
+        // parallelMarkContexts[0] is processed by the main thread, so its thread is never started
+        uint startedParallelThreadEndIndex = 1;
 
         if (startAllThreads)
         {
-            if (this->enableParallelMark && this->maxParallelism > 2)
+            if (this->enableParallelMark)
             {
-                if (!parallelThread1.EnableConcurrent(true))
-                {
-                    startConcurrentThread = false;
-                }
-                else
+                while (startedParallelThreadEndIndex < this->parallelMarkContextCount)
                 {
-                    startedParallelThread1 = true;
-                    if (this->maxParallelism > 3)
+                    if (!this->parallelMarkContexts[startedParallelThreadEndIndex]->parallelThread.EnableConcurrent(true))
                     {
-                        if (!parallelThread2.EnableConcurrent(true))
-                        {
-                            startConcurrentThread = false;
-                        }
-                        else
-                        {
-                            startedParallelThread2 = true;
-                        }
+                        startConcurrentThread = false;
+                        break;
                     }
+                    startedParallelThreadEndIndex++;
                 }
             }
         }
@@ -4971,13 +5427,9 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
             }
         }
 
-        if (startedParallelThread1)
+        for (uint i = 1; i < startedParallelThreadEndIndex; i++)
         {
-            parallelThread1.Shutdown();
-            if (startedParallelThread2)
-            {
-                parallelThread2.Shutdown();
-            }
+            this->parallelMarkContexts[i]->parallelThread.Shutdown();
         }
     }
 
@@ -5084,6 +5536,13 @@ Recycler::StartBackgroundMark(bool foregroundResetMark, bool foregroundFindRoots
 
     CollectionState backgroundState = CollectionStateConcurrentResetMarks;
 
+    // Whatever an abandoned collection found is stale once the marks are reset. Do it here, as the
+    // background thread can't touch the weak reference map while script may be using it.
+    {
+        AutoCriticalSection lock(&this->weakReferenceMapCriticalSection);
+        this->weakReferenceMap.ClearSweepCandidates();
+    }
+
     bool doBackgroundFindRoots = true;
     if (foregroundResetMark || foregroundFindRoots)
     {
@@ -5438,9 +5897,36 @@ Recycler::BackgroundFinishMark()
     RECYCLER_PROFILE_EXEC_BACKGROUND_BEGIN(this, Js::MarkPhase);
     ProcessMark(true);
     RECYCLER_PROFILE_EXEC_BACKGROUND_END(this, Js::MarkPhase);
+
+    if (GetRecyclerFlagsTable().ConcurrentWeakReferenceSweep)
+    {
+        this->BackgroundCollectWeakReferenceSweepCandidates();
+    }
     return rescannedRootBytes;
 }
 
+void
+Recycler::BackgroundCollectWeakReferenceSweepCandidates()
+{
+    // Script may be running if the main thread stopped waiting for us. Don't wait for it to be done
+    // with the weak reference map: it may itself be waiting for us, and the sweep can always go
+    // through the whole map instead.
+    if (!this->weakReferenceMapCriticalSection.TryEnter())
+    {
+        return;
+    }
+
+    // Marks only get added until the sweep, so the entries that are alive now are still alive then.
+    // Only the others, and the ones created from now on, need to be looked at in-thread.
+    this->weakReferenceMap.CollectSweepCandidates([](RecyclerWeakReferenceBase * weakRef) -> bool
+    {
+        return weakRef->weakRefHeapBlock->TestObjectMarkedBit(weakRef)
+            && weakRef->strongRefHeapBlock->TestObjectMarkedBit(weakRef->strongRef);
+    });
+
+    this->weakReferenceMapCriticalSection.Leave();
+}
+
 void
 Recycler::SweepPendingObjects(RecyclerSweep& recyclerSweep)
 {
@@ -5480,10 +5966,246 @@ Recycler::FinishConcurrentCollectWrapped(CollectionFlags flags)
     this->skipStack = ((flags & CollectOverride_SkipStack) != 0);
     DebugOnly(this->isConcurrentGCOnIdle = (flags == CollectOnScriptIdle));
 #endif
+
+    LARGE_INTEGER pauseStartTime;
+    QueryPerformanceCounter(&pauseStartTime);
     BOOL collected = collectionWrapper->ExecuteRecyclerCollectionFunction(this, &Recycler::FinishConcurrentCollect, flags);
+    this->RecordPause(pauseStartTime);
     return collected;
 }
 
+void
+Recycler::RecordPause(LARGE_INTEGER const& pauseStartTime)
+{
+    LARGE_INTEGER pauseEndTime;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&pauseEndTime);
+    QueryPerformanceFrequency(&frequency);
+    this->pauseHistogram.Record((uint64)(pauseEndTime.QuadPart - pauseStartTime.QuadPart) * 1000000 / (uint64)frequency.QuadPart);
+}
+
+void
+RecyclerPauseHistogram::Record(uint64 microseconds)
+{
+    uint bucket = 0;
+    uint64 bucketLimit = FirstBucketMicroseconds;
+    while (microseconds >= bucketLimit && bucket < BucketCount - 1)
+    {
+        bucket++;
+        bucketLimit <<= 1;
+    }
+    this->counts[bucket]++;
+}
+
+void
+Recycler::SetAllocationSampleInterval(size_t interval)
+{
+    this->allocationSampleInterval = interval;
+    if (interval == 0)
+    {
+        this->allocationSampleGap = 0;
+        this->bytesUntilAllocationSample = SIZE_MAX;
+    }
+    else
+    {
+        ScheduleAllocationSample();
+    }
+
+    if (this->sizeHistogram != nullptr)
+    {
+        this->histogramBytesUntilAllocationSample = this->bytesUntilAllocationSample;
+        this->bytesUntilAllocationSample = 0;
+    }
+}
+
+void
+Recycler::CountAllocationSlow(size_t size, size_t allocSize)
+{
+    if (this->sizeHistogram == nullptr)
+    {
+        this->TakeAllocationSample(size);
+        return;
+    }
+
+    this->sizeHistogram->Record(size, allocSize);
+    if (this->histogramBytesUntilAllocationSample <= size)
+    {
+        this->bytesUntilAllocationSample = this->histogramBytesUntilAllocationSample;
+        this->TakeAllocationSample(size);
+
+        // The sample callback may have turned sampling off
+        this->histogramBytesUntilAllocationSample = (this->allocationSampleInterval != 0) ? this->bytesUntilAllocationSample : SIZE_MAX;
+    }
+    else
+    {
+        this->histogramBytesUntilAllocationSample -= size;
+    }
+    this->bytesUntilAllocationSample = 0;
+}
+
+void
+Recycler::ScheduleAllocationSample()
+{
+    // Pick the next sample point at random in [interval / 2, interval * 3 / 2) so that the samples
+    // average one per interval without lining up with a periodic allocation pattern
+    size_t interval = this->allocationSampleInterval;
+    Assert(interval != 0);
+    size_t gap = interval / 2 + (size_t)this->collectionWrapper->GetRandomNumber() % interval;
+    this->allocationSampleGap = max(gap, (size_t)1);
+    this->bytesUntilAllocationSample = this->allocationSampleGap;
+}
+
+void
+Recycler::TakeAllocationSample(size_t size)
+{
+    if (this->allocationSampleInterval == 0)
+    {
+        // Only reached with sampling off for a size that doesn't fit in memory, let the allocation fail
+        return;
+    }
+
+    // Everything allocated since the last sample gets charged to this allocation
+    size_t sampledBytes = this->allocationSampleGap - this->bytesUntilAllocationSample + size;
+
+    // The callback may allocate, don't sample those allocations
+    this->bytesUntilAllocationSample = SIZE_MAX;
+    this->collectionWrapper->AllocationSampleCallBack(size, sampledBytes);
+
+    if (this->allocationSampleInterval != 0)
+    {
+        ScheduleAllocationSample();
+    }
+}
+
+char *
+Recycler::AllocZeroPretenured(size_t size)
+{
+    if (!this->enablePretenuring || !HeapInfo::IsSmallObject(size))
+    {
+        return this->AllocZero(size);
+    }
+
+    Assert(!this->IsHeapEnumInProgress() || this->AllowAllocationDuringHeapEnum());
+
+#ifdef PROFILE_RECYCLER_ALLOC
+    TrackAllocData trackAllocData;
+    ClearTrackAllocInfo(&trackAllocData);
+#endif
+
+    size_t sizeCat = HeapInfo::GetAlignedSizeNoCheck(size);
+    PretenuredBlockAllocator * allocator = &this->pretenuredAllocators[HeapInfo::GetBucketIndex(sizeCat)];
+    char * memBlock = allocator->InlinedAlloc<(ObjectInfoBits)(PretenuredObjectBits & InternalObjectInfoBitMask)>(this, sizeCat);
+    if (memBlock == nullptr)
+    {
+        memBlock = this->SmallAllocatorAlloc<PretenuredObjectBits>(allocator, sizeCat, size);
+        Assert(memBlock != nullptr);
+    }
+
+#ifdef PROFILE_RECYCLER_ALLOC
+    TrackAlloc(memBlock, size, trackAllocData);
+#endif
+    RecyclerMemoryTracking::ReportAllocation(this, memBlock, size);
+    CountAllocation(size, sizeCat);
+    RECYCLER_PERF_COUNTER_INC(LiveObject);
+    RECYCLER_PERF_COUNTER_ADD(LiveObjectSize, sizeCat);
+    RECYCLER_PERF_COUNTER_SUB(FreeObjectSize, sizeCat);
+    RECYCLER_PERF_COUNTER_INC(SmallHeapBlockLiveObject);
+    RECYCLER_PERF_COUNTER_ADD(SmallHeapBlockLiveObjectSize, sizeCat);
+    RECYCLER_PERF_COUNTER_SUB(SmallHeapBlockFreeObjectSize, sizeCat);
+
+    // Only the free list pointer is known to be zero, see AllocZeroWithAttributesInlined
+    memset(memBlock, 0, size);
+    return memBlock;
+}
+
+bool
+Recycler::EnableSizeHistogram()
+{
+    if (this->sizeHistogram == nullptr)
+    {
+        this->sizeHistogram = NoMemProtectHeapNewNoThrow(RecyclerSizeHistogram);
+        if (this->sizeHistogram == nullptr)
+        {
+            return false;
+        }
+
+        // Send every allocation to the slow path, see CountAllocationSlow
+        this->histogramBytesUntilAllocationSample = this->bytesUntilAllocationSample;
+        this->bytesUntilAllocationSample = 0;
+    }
+    return true;
+}
+
+void
+RecyclerSizeHistogram::Record(size_t requestedSize, size_t allocSize)
+{
+    uint index;
+    size_t allocatedSize;
+    if (HeapInfo::IsSmallObject(allocSize))
+    {
+        allocatedSize = HeapInfo::GetAlignedSizeNoCheck(allocSize);
+        index = HeapInfo::GetBucketIndex(allocatedSize);
+    }
+    else if (HeapInfo::IsMediumObject(allocSize))
+    {
+        allocatedSize = HeapInfo::GetMediumObjectAlignedSizeNoCheck(allocSize);
+        index = HeapConstants::BucketCount + HeapInfo::GetMediumBucketIndex(allocatedSize);
+    }
+    else
+    {
+        allocatedSize = allocSize;
+        index = LargeEntryIndex;
+    }
+
+    Assert(index < EntryCount);
+    Entry& entry = this->entries[index];
+    entry.allocationCount++;
+    entry.requestedBytes += requestedSize;
+    entry.allocatedBytes += allocatedSize;
+}
+
+uint
+RecyclerSizeHistogram::GetBucketSize(uint index)
+{
+    Assert(index < EntryCount);
+    if (index < HeapConstants::BucketCount)
+    {
+        return (index + 1) * HeapConstants::ObjectGranularity;
+    }
+    if (index < LargeEntryIndex)
+    {
+        return HeapConstants::MaxSmallObjectSize + (index - HeapConstants::BucketCount + 1) * HeapConstants::MediumObjectGranularity;
+    }
+    return 0;
+}
+
+void
+RecyclerSizeHistogram::Print() const
+{
+    Output::Print(_u("Allocation size histogram\n"));
+    Output::Print(_u("%8s %12s %16s %16s %16s\n"), _u("Bucket"), _u("Count"), _u("Requested"), _u("Allocated"), _u("Wasted"));
+    for (uint i = 0; i < EntryCount; i++)
+    {
+        Entry const& entry = this->entries[i];
+        if (entry.allocationCount == 0)
+        {
+            continue;
+        }
+
+        uint bucketSize = GetBucketSize(i);
+        if (bucketSize != 0)
+        {
+            Output::Print(_u("%8u "), bucketSize);
+        }
+        else
+        {
+            Output::Print(_u("%8s "), _u("Large"));
+        }
+        Output::Print(_u("%12llu %16llu %16llu %16llu\n"), entry.allocationCount, entry.requestedBytes, entry.allocatedBytes,
+            entry.allocatedBytes - entry.requestedBytes);
+    }
+}
+
 BOOL
 Recycler::WaitForConcurrentThread(DWORD waitTime)
 {
@@ -5603,7 +6325,7 @@ Recycler::FinishConcurrentCollect(CollectionFlags flags)
     collectionParam.priorityBoostConcurrentSweepOverride = priorityBoost;
 #endif
 
-    const DWORD waitTime = forceInThread? INFINITE : RecyclerHeuristic::FinishConcurrentCollectWaitTime(this->GetRecyclerFlagsTable());
+    const DWORD waitTime = forceInThread? INFINITE : RecyclerHeuristic::FinishConcurrentCollectWaitTime(this->pauseBudget, this->GetRecyclerFlagsTable());
     GCETW(GC_FINISHCONCURRENTWAIT_START, (this, waitTime));
     const BOOL waited = WaitForConcurrentThread(waitTime);
     GCETW(GC_FINISHCONCURRENTWAIT_STOP, (this, !waited));
@@ -5639,7 +6361,8 @@ Recycler::FinishConcurrentCollect(CollectionFlags flags)
 #endif
 
         const bool backgroundFinishMark = !forceInThread && concurrent && ((flags & CollectOverride_BackgroundFinishMark) != 0);
-        const DWORD finishMarkWaitTime = RecyclerHeuristic::BackgroundFinishMarkWaitTime(backgroundFinishMark, GetRecyclerFlagsTable());
+        const DWORD finishMarkPauseBudget = (!forceInThread && concurrent) ? this->pauseBudget : 0;
+        const DWORD finishMarkWaitTime = RecyclerHeuristic::BackgroundFinishMarkWaitTime(backgroundFinishMark, finishMarkPauseBudget, GetRecyclerFlagsTable());
         size_t rescanRootBytes = FinishMark(finishMarkWaitTime);
 
         if (rescanRootBytes == Recycler::InvalidScanRootBytes)
@@ -6121,6 +6844,8 @@ Recycler::FinishCollection()
     {
         ForEachPageAllocator([](IdleDecommitPageAllocator* pageAlloc)
         {
+            // The thread page allocator also serves the thread's arenas
+            pageAlloc->ReleaseArenaBlockCache();
             pageAlloc->DecommitNow(false);
         });
         this->decommitOnFinish = false;
@@ -6424,13 +7149,13 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
 }
 
 
-template <uint parallelId>
 void
-Recycler::ParallelWorkFunc()
+Recycler::ParallelWorkFunc(uint parallelId)
 {
-    Assert(parallelId == 0 || parallelId == 1);
+    // parallelMarkContexts[0] is processed by the main thread
+    Assert(parallelId > 0 && parallelId < this->parallelMarkContextCount);
 
-    MarkContext * markContext = (parallelId == 0 ? &this->parallelMarkContext2 : &this->parallelMarkContext3);
+    MarkContext * markContext = &this->parallelMarkContexts[parallelId]->markContext;
 
     switch (this->collectionState)
     {
@@ -6442,6 +7167,11 @@ Recycler::ParallelWorkFunc()
             this->ProcessParallelMark(true, markContext);
             break;
 
+        case CollectionStateConcurrentSweep:
+            Assert(this->recyclerSweep != nullptr && this->recyclerSweep->IsBackground());
+            this->autoHeap.SweepSmallNonFinalizableBuckets(*this->recyclerSweep);
+            break;
+
         default:
             Assert(false);
     }
@@ -6457,6 +7187,15 @@ RecyclerParallelThread::WaitForConcurrent()
     Assert(ret == WAIT_OBJECT_0);
 }
 
+bool
+RecyclerParallelThread::TryWaitForConcurrent()
+{
+    Assert(this->concurrentThread != NULL || this->recycler->threadService->HasCallback());
+    Assert(this->concurrentWorkDoneEvent != NULL);
+
+    return WaitForSingleObject(concurrentWorkDoneEvent, 0) == WAIT_OBJECT_0;
+}
+
 void
 RecyclerParallelThread::Shutdown()
 {
@@ -6511,6 +7250,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
         RecyclerParallelThread * parallelThread = (RecyclerParallelThread *)lpParameter;
         Recycler * recycler = parallelThread->recycler;
         RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
+        uint parallelId = parallelThread->parallelId;
 
         Assert(recycler->IsConcurrentEnabled());
 
@@ -6548,7 +7288,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+            (recycler->*workFunc)(parallelId);
 
             // We always wait after the first time
             mustWait = true;
@@ -6587,7 +7327,7 @@ RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
     Recycler * recycler = parallelThread->recycler;
     RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
-    (recycler->*workFunc)();
+    (recycler->*workFunc)(parallelThread->parallelId);
 
     SetEvent(parallelThread->concurrentWorkDoneEvent);
 }
@@ -6922,6 +7662,23 @@ Recycler::PrintMarkCollectionStats()
         collectionStats.stackCount, collectionStats.markThruFalseNewObjCount);
 }
 
+#if ENABLE_CONCURRENT_GC
+void
+Recycler::PrintParallelMarkCollectionStats()
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+
+    Output::Print(_u("---------------------------------------------------------------------------------------------------------------\n"));
+    Output::Print(_u("Parallel Mark : Steal :%9d | Time (ms) by mark context:"), collectionStats.parallelMarkStealCount);
+    for (uint i = 0; i < this->parallelMarkContextCount + 1; i++)
+    {
+        Output::Print(_u(" %2d:%8.3f"), i, (double)collectionStats.parallelMarkTime[i] * 1000 / (double)frequency.QuadPart);
+    }
+    Output::Print(_u("\n"));
+}
+
+#endif
 void
 Recycler::PrintBackgroundCollectionStat(RecyclerCollectionStats::MarkData const& markData)
 {
@@ -7035,6 +7792,13 @@ Recycler::PrintMemoryStats()
         , collectionStats.numEmptySmallBlocks[HeapBlock::SmallLeafBlockType]
         + collectionStats.numEmptySmallBlocks[HeapBlock::MediumLeafBlockType],
         collectionStats.numZeroedOutSmallBlocks);
+
+    if (this->GetRecyclerFlagsTable().LeafBlockDensityOrdering)
+    {
+        Output::Print(_u("Sparse leaf blocks: %d (%d free bytes)\nSparse leaf blocks reclaimed: %d (%d bytes)\n"),
+            collectionStats.sparseLeafBlockCount, collectionStats.sparseLeafBlockFreeBytes,
+            collectionStats.sparseLeafBlockReclaimedCount, collectionStats.sparseLeafBlockReclaimedBytes);
+    }
 }
 
 void
@@ -7044,6 +7808,12 @@ Recycler::PrintCollectStats()
 
     PrintHeuristicCollectionStats();
     PrintMarkCollectionStats();
+#if ENABLE_CONCURRENT_GC
+    if (this->enableParallelMark)
+    {
+        PrintParallelMarkCollectionStats();
+    }
+#endif
     PrintBackgroundCollectionStats();
 
     size_t freeCount = collectionStats.objectSweptCount - collectionStats.objectSweptFreeListCount;
@@ -120,6 +120,7 @@ struct InfoBitsWrapper{};
 #define RecyclerNewPlus(recycler,size,T,...) AllocatorNewPlus(Recycler, recycler, size, T, __VA_ARGS__)
 #define RecyclerNewPlusZ(recycler,size,T,...) AllocatorNewPlusZ(Recycler, recycler, size, T, __VA_ARGS__)
 #define RecyclerNewZ(recycler,T,...) AllocatorNewBase(Recycler, recycler, AllocZeroInlined, T, __VA_ARGS__)
+#define RecyclerNewPretenuredPlusZ(recycler,size,T,...) AllocatorNewPlusBase(Recycler, recycler, AllocZeroPretenured, size, T, __VA_ARGS__)
 #define RecyclerNewStruct(recycler,T) AllocatorNewStructBase(Recycler, recycler, AllocInlined, T)
 #define RecyclerNewStructZ(recycler,T) AllocatorNewStructBase(Recycler, recycler, AllocZeroInlined, T)
 #define RecyclerNewStructPlus(recycler,size,T) AllocatorNewStructPlus(Recycler, recycler, size, T)
@@ -334,6 +335,9 @@ enum CollectionFlags
 #endif
 };
 
+// Reports a reference from an object to the heap snapshot writer, under a name like the property it is stored in
+typedef void (CALLBACK * RecyclerHeapSnapshotReferenceCallback)(void * context, char16 const * name, void * reference);
+
 class RecyclerCollectionWrapper
 {
 public:
@@ -355,6 +359,9 @@ public:
     virtual uint GetRandomNumber() = 0;
     virtual bool DoSpecialMarkOnScanStack() = 0;
     virtual void PostSweepRedeferralCallBack() = 0;
+    virtual char16 const * GetHeapSnapshotObjectName(void * objectAddress, size_t objectSize) = 0;
+    virtual void ForEachHeapSnapshotReference(void * objectAddress, size_t objectSize, RecyclerHeapSnapshotReferenceCallback callback, void * context) = 0;
+    virtual void AllocationSampleCallBack(size_t size, size_t sampledBytes) = 0;
 
 #ifdef FAULT_INJECTION
     virtual void DisposeScriptContextByFaultInjectionCallBack() = 0;
@@ -405,6 +412,9 @@ public:
     virtual uint GetRandomNumber() override { return 0; }
     virtual bool DoSpecialMarkOnScanStack() override { return false; }
     virtual void PostSweepRedeferralCallBack() override {}
+    virtual char16 const * GetHeapSnapshotObjectName(void * objectAddress, size_t objectSize) override { return nullptr; }
+    virtual void ForEachHeapSnapshotReference(void * objectAddress, size_t objectSize, RecyclerHeapSnapshotReferenceCallback callback, void * context) override {}
+    virtual void AllocationSampleCallBack(size_t size, size_t sampledBytes) override {}
 #ifdef FAULT_INJECTION
     virtual void DisposeScriptContextByFaultInjectionCallBack() override {};
 #endif
@@ -481,6 +491,10 @@ struct RecyclerCollectionStats
 #if ENABLE_CONCURRENT_GC
     MarkData backgroundMarkData[RecyclerHeuristic::MaxBackgroundRepeatMarkCount];
     size_t trackedObjectCount;
+
+    // Parallel mark stats
+    size_t parallelMarkStealCount;                              // mark stack chunks stolen from other mark contexts
+    uint64 parallelMarkTime[MarkContext::MaxParallelism];       // QPC ticks spent marking, per mark context (0 is the main markContext)
 #endif
 
 #if ENABLE_PARTIAL_GC
@@ -516,6 +530,12 @@ struct RecyclerCollectionStats
     // Empty/zero heap block stats
     uint numEmptySmallBlocks[HeapBlock::SmallBlockTypeCount];
     uint numZeroedOutSmallBlocks;
+
+    // Leaf block density ordering stats
+    size_t sparseLeafBlockCount;            // leaf blocks moved to the end of the allocable list
+    size_t sparseLeafBlockFreeBytes;        // free bytes in those blocks
+    size_t sparseLeafBlockReclaimedCount;   // previously sparse leaf blocks that became empty and were freed
+    size_t sparseLeafBlockReclaimedBytes;
 };
 #define RECYCLER_STATS_INC_IF(cond, r, f) if (cond) { RECYCLER_STATS_INC(r, f); }
 #define RECYCLER_STATS_INC(r, f) ++r->collectionStats.f
@@ -555,17 +575,66 @@ struct CollectionParam
 };
 #endif
 
+// Counts of the collections that blocked the thread, by how long they blocked it.
+// Bucket 0 holds the pauses shorter than FirstBucketMicroseconds, each following bucket
+// is twice as wide as the one before it, and the last one holds all the longer pauses.
+class RecyclerPauseHistogram
+{
+public:
+    static const uint BucketCount = 16;
+    static const uint FirstBucketMicroseconds = 128;
+
+    RecyclerPauseHistogram() { Reset(); }
+
+    void Reset() { memset(this->counts, 0, sizeof(this->counts)); }
+    void Record(uint64 microseconds);
+    uint GetCount(uint bucket) const { Assert(bucket < BucketCount); return this->counts[bucket]; }
+
+private:
+    uint counts[BucketCount];
+};
+
+// Allocations and the bytes they actually take up, by size class, to see what rounding requests up
+// to the bucket sizes costs a workload. The first HeapConstants::BucketCount entries are the small
+// buckets, followed by the medium buckets, and the last entry is all the large allocations.
+class RecyclerSizeHistogram
+{
+public:
+    static const uint EntryCount = HeapConstants::BucketCount + HeapConstants::MediumBucketCount + 1;
+    static const uint LargeEntryIndex = EntryCount - 1;
+
+    struct Entry
+    {
+        uint64 allocationCount;
+        uint64 requestedBytes;
+        uint64 allocatedBytes;
+    };
+
+    RecyclerSizeHistogram() { memset(this->entries, 0, sizeof(this->entries)); }
+
+    void Record(size_t requestedSize, size_t allocSize);
+    Entry const& GetEntry(uint index) const { Assert(index < EntryCount); return this->entries[index]; }
+
+    // Object size of the bucket an entry is for, or 0 for the large allocations
+    static uint GetBucketSize(uint index);
+    void Print() const;
+
+private:
+    Entry entries[EntryCount];
+};
+
 #include "RecyclerObjectGraphDumper.h"
 
 #if ENABLE_CONCURRENT_GC
 class RecyclerParallelThread
 {
 public:
-    typedef void (Recycler::* WorkFunc)();
+    typedef void (Recycler::* WorkFunc)(uint parallelId);
 
-    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc) :
+    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc, uint parallelId) :
         recycler(recycler),
         workFunc(workFunc),
+        parallelId(parallelId),
         concurrentWorkReadyEvent(NULL),
         concurrentWorkDoneEvent(NULL),
         concurrentThread(NULL)
@@ -581,6 +650,7 @@ public:
 
     bool StartConcurrent();
     void WaitForConcurrent();
+    bool TryWaitForConcurrent();
     void Shutdown();
     bool EnableConcurrent(bool synchronizeOnStartup);
 
@@ -594,6 +664,7 @@ private:
 private:
     WorkFunc workFunc;
     Recycler * recycler;
+    uint parallelId;
     HANDLE concurrentWorkReadyEvent;// main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent;// concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
@@ -641,6 +712,7 @@ class Recycler
     friend class ActiveScriptProfilerHeapEnum;
 #endif
     friend class ScriptEngineBase;  // This is for disabling GC for certain Host operations.
+    friend class RecyclerHeapSnapshotWriter;
     friend class ::CodeGenNumberThreadAllocator;
     friend struct ::XProcNumberPageSegmentManager;
 public:
@@ -765,6 +837,17 @@ private:
 
     WeakReferenceHashTable<PrimePolicy> weakReferenceMap;
     uint weakReferenceCleanupId;
+    RecyclerEphemeronTable ephemeronTable;
+#if ENABLE_CONCURRENT_GC
+    // Held by the background thread while it looks for the weak references the sweep needs to check
+    CriticalSection weakReferenceMapCriticalSection;
+    CriticalSection * GetWeakReferenceMapCriticalSection()
+    {
+        // The background thread can only be looking at the map while it is executing
+        return this->IsConcurrentExecutingState() ? &this->weakReferenceMapCriticalSection : nullptr;
+    }
+    void BackgroundCollectWeakReferenceSweepCandidates();
+#endif
 
     void * transientPinnedObject;
 #if defined(CHECK_MEMORY_LEAK) || defined(LEAK_REPORT)
@@ -822,21 +905,116 @@ private:
 
     MarkContext markContext;
 
-    // Contexts for parallel marking.
-    // We support up to 4 way parallelism, main context + 3 additional parallel contexts.
-    MarkContext parallelMarkContext1;
-    MarkContext parallelMarkContext2;
-    MarkContext parallelMarkContext3;
-
-    // Page pools for above markContexts
+    // Page pool for above markContext
     PagePool markPagePool;
-    PagePool parallelMarkPagePool1;
-    PagePool parallelMarkPagePool2;
-    PagePool parallelMarkPagePool3;
+
+#if ENABLE_CONCURRENT_GC
+    // Contexts for parallel marking, one per way of parallelism beyond the main markContext.
+    // They are sized from maxParallelism when the recycler is initialized, so marking scales with
+    // the number of processors instead of being limited to 4-way parallelism.
+    // The main thread processes parallelMarkContexts[0] itself, and parallelMarkContexts[i]'s
+    // parallelThread processes the rest, so the thread for entry 0 is never started.
+    class ParallelMarkContext
+    {
+    public:
+        ParallelMarkContext(Recycler * recycler, uint parallelId) :
+            pagePool(recycler->GetRecyclerFlagsTable()),
+            markContext(recycler, &pagePool),
+            parallelThread(recycler, &Recycler::ParallelWorkFunc, parallelId)
+        {
+        }
+
+        PagePool pagePool;
+        MarkContext markContext;
+        MarkContext::MarkStealDeque stealDeque;
+        RecyclerParallelThread parallelThread;
+    };
+
+    uint parallelMarkContextCount;
+    ParallelMarkContext ** parallelMarkContexts;
+
+    // Mark stack chunks published by the main markContext during parallel mark
+    MarkContext::MarkStealDeque markStealDeque;
+
+    // Number of mark contexts still being processed during parallel mark.
+    // Threads that run out of work keep trying to steal until this drops to zero.
+    volatile LONG parallelMarkActiveCount;
+
+    // End of the range of parallel threads helping with the current background sweep
+    uint parallelSweepStartedEndIndex;
+
+    bool InitializeParallelMarkContexts();
+    void DeleteParallelMarkContexts();
+    uint StartParallelThreads(uint startIndex, uint endIndex);
+    void FinishParallelMark(bool background, uint startIndex, uint endIndex, uint startedEndIndex);
+    void SetParallelMarkWorkStealing(bool enable);
+    bool StealParallelMarkWork(MarkContext * markContext);
+#ifdef RECYCLER_STATS
+    uint GetParallelMarkContextIndex(MarkContext * markContext) const;
+#endif
+    bool StartParallelSweep();
+    void FinishParallelSweep();
+
+    // Thread-agnostic finalize callbacks queued during sweep and dispose. The pending queue is filled by
+    // the main thread, and handed off to backgroundFinalizeQueue for the finalizer thread to run, one
+    // batch at a time.
+    RecyclerBackgroundFinalizeQueue pendingBackgroundFinalizeQueue;
+    RecyclerBackgroundFinalizeQueue backgroundFinalizeQueue;
+    RecyclerParallelThread backgroundFinalizeThread;
+    bool enableBackgroundFinalize;
+    bool backgroundFinalizeInProgress;
+
+    void StartBackgroundFinalize();
+    void FinishBackgroundFinalize();
+    void BackgroundFinalizeWorkFunc(uint parallelId);
+#endif
+
+    template <typename Fn>
+    void ForEachParallelMarkContext(Fn fn)
+    {
+#if ENABLE_CONCURRENT_GC
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            fn(&this->parallelMarkContexts[i]->markContext);
+        }
+#endif
+    }
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const
+    {
+        if (markContext.HasPendingMarkObjects())
+        {
+            return true;
+        }
+#if ENABLE_CONCURRENT_GC
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            if (this->parallelMarkContexts[i]->markContext.HasPendingMarkObjects())
+            {
+                return true;
+            }
+        }
+#endif
+        return false;
+    }
+    bool HasPendingTrackObjects() const
+    {
+        if (markContext.HasPendingTrackObjects())
+        {
+            return true;
+        }
+#if ENABLE_CONCURRENT_GC
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            if (this->parallelMarkContexts[i]->markContext.HasPendingTrackObjects())
+            {
+                return true;
+            }
+        }
+#endif
+        return false;
+    }
 
     RecyclerCollectionWrapper * collectionWrapper;
 
@@ -951,20 +1129,17 @@ private:
     bool enableParallelMark;
     bool enableConcurrentSweep;
 
-    uint maxParallelism;        // Max # of total threads to run in parallel
+    uint maxParallelism;        // Max # of total threads to run in parallel, including the main and concurrent threads
 
     byte backgroundRescanCount;             // for ETW events and stats
     byte backgroundFinishMarkCount;
+    DWORD pauseBudget;                      // in milliseconds, 0 if the thread may block as long as the collection needs
     size_t backgroundRescanRootBytes;
     HANDLE concurrentWorkReadyEvent; // main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent; // concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
 
-    template <uint parallelId>
-    void ParallelWorkFunc();
-
-    RecyclerParallelThread parallelThread1;
-    RecyclerParallelThread parallelThread2;
+    void ParallelWorkFunc(uint parallelId);
 
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
@@ -1056,12 +1231,38 @@ private:
     void PrintHeuristicCollectionStats();
     void PrintMarkCollectionStats();
     void PrintBackgroundCollectionStats();
+#if ENABLE_CONCURRENT_GC
+    void PrintParallelMarkCollectionStats();
+#endif
     void PrintMemoryStats();
     void PrintBackgroundCollectionStat(RecyclerCollectionStats::MarkData const& markData);
 #endif
 #ifdef RECYCLER_TRACE
     CollectionParam collectionParam;
 #endif
+    RecyclerPauseHistogram pauseHistogram;
+    RecyclerSizeHistogram * sizeHistogram;
+    // Allocation sampling: bytesUntilAllocationSample counts down to the next sample, and is
+    // SIZE_MAX when sampling is off so that the allocation path only needs the one compare.
+    // While the size histogram is on, it is held at 0 so that every allocation takes the slow path,
+    // and the count down to the next sample is kept in histogramBytesUntilAllocationSample instead.
+    size_t allocationSampleInterval;
+    size_t allocationSampleGap;
+    size_t bytesUntilAllocationSample;
+    size_t histogramBytesUntilAllocationSample;
+
+    // Pretenuring: objects expected to be long-lived are allocated through allocators of their own.
+    // These only fill new heap blocks, and the normal allocators skip those blocks, so long-lived objects
+    // don't share blocks with short-lived ones. The slots freed in a pretenured block aren't reused:
+    // its pages come back when the whole block is empty.
+#if GLOBAL_ENABLE_WRITE_BARRIER && !defined(_WIN32)
+    static const ObjectInfoBits PretenuredObjectBits = WithBarrierBit;
+#else
+    static const ObjectInfoBits PretenuredObjectBits = NoBit;
+#endif
+    typedef SmallHeapBlockAllocator<SmallHeapBlockType<PretenuredObjectBits, SmallAllocationBlockAttributes>::BlockType> PretenuredBlockAllocator;
+    PretenuredBlockAllocator pretenuredAllocators[HeapConstants::BucketCount];
+    bool enablePretenuring;
 #ifdef RECYCLER_MEMORY_VERIFY
     uint verifyPad;
     bool verifyEnabled;
@@ -1097,6 +1298,15 @@ public:
 #endif
 
     void Prime();
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    void EnableHugePages();
+#endif
+#if ENABLE_CONCURRENT_GC
+    void EnableBackgroundFinalize() { this->enableBackgroundFinalize = true; }
+#endif
+    // Queues a finalize callback that may run on any thread, to be run on the background finalizer thread.
+    // Returns false if the callback can't be queued, in which case the caller should run it itself.
+    bool QueueBackgroundFinalize(RecyclerBackgroundFinalizeCallback callback, void * data);
     void* GetOwnerContext() { return (void*) this->collectionWrapper; }
     PageAllocator * GetPageAllocator() { return threadPageAllocator; }
     bool NeedOOMRescan() const;
@@ -1192,6 +1402,46 @@ public:
 #endif
 
     void SetCollectionWrapper(RecyclerCollectionWrapper * wrapper);
+
+    // Bound the time the thread is blocked waiting for the concurrent collection to finish marking,
+    // by handing the rest of the mark back to the background thread and resuming script
+    void SetPauseBudget(DWORD pauseBudget)
+    {
+#if ENABLE_CONCURRENT_GC
+        this->pauseBudget = pauseBudget;
+#endif
+    }
+    RecyclerPauseHistogram const& GetPauseHistogram() const { return this->pauseHistogram; }
+
+    // Start recording allocations by size class. Returns false if we are out of memory.
+    bool EnableSizeHistogram();
+    RecyclerSizeHistogram const * GetSizeHistogram() const { return this->sizeHistogram; }
+
+    // Report an allocation to the collection wrapper about every interval bytes allocated, 0 stops sampling
+    void SetAllocationSampleInterval(size_t interval);
+    size_t GetAllocationSampleInterval() const { return this->allocationSampleInterval; }
+    // Count an allocation for sampling and the size histogram. allocSize is the size actually asked
+    // of the heap, which decides the size class.
+    void CountAllocation(size_t size, size_t allocSize)
+    {
+        if (this->bytesUntilAllocationSample <= size)
+        {
+            this->CountAllocationSlow(size, allocSize);
+        }
+        else
+        {
+            this->bytesUntilAllocationSample -= size;
+        }
+    }
+private:
+    _NOINLINE void CountAllocationSlow(size_t size, size_t allocSize);
+    void TakeAllocationSample(size_t size);
+    void ScheduleAllocationSample();
+public:
+    // Allocate a zeroed normal object that is expected to be long-lived. Objects too large for the
+    // small heap blocks, or allocated with pretenuring off, get a normal allocation.
+    char * AllocZeroPretenured(DECLSPEC_GUARD_OVERFLOW size_t size);
+    bool IsPretenuringEnabled() const { return this->enablePretenuring; }
     static size_t GetAlignedSize(size_t size) { return HeapInfo::GetAlignedSize(size); }
     HeapInfo* GetAutoHeap() { return &autoHeap; }
     template <CollectionFlags flags>
@@ -1311,6 +1561,11 @@ public:
     template<typename T>
     bool TryGetWeakReferenceHandle(T* pStrongReference, RecyclerWeakReference<T> **weakReference);
 
+    // Map (owner, key) to a value that is kept alive for as long as both owner and key are, see RecyclerEphemeronTable
+    void SetEphemeron(void * owner, void * key, void * value) { ephemeronTable.Set(owner, key, value); }
+    bool TryGetEphemeron(void * owner, void * key, void ** value) const { return ephemeronTable.TryGetValue(owner, key, value); }
+    bool RemoveEphemeron(void * owner, void * key) { return ephemeronTable.Remove(owner, key); }
+
     template <ObjectInfoBits attributes>
     char* GetAddressOfAllocator(size_t sizeCat)
     {
@@ -1363,6 +1618,7 @@ public:
 
     void HeapFree(HeapInfo* eHeap,void* candidate);
 
+    // Enumerates the objects that have any of the infoBits, or every object if infoBits is NoBit
     void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
 
     void RootAddRef(void* obj, uint *count = nullptr);
@@ -1509,6 +1765,7 @@ private:
     BOOL DoCollect(CollectionFlags flags);
     BOOL DoCollectWrapped(CollectionFlags flags);
     BOOL CollectOnAllocatorThread();
+    void RecordPause(LARGE_INTEGER const& pauseStartTime);
 
 #if DBG
     void ResetThreadId();
@@ -1535,6 +1792,7 @@ private:
     void Mark();
     bool EndMark();
     bool EndMarkCheckOOMRescan();
+    bool EndMarkEphemerons();
     void EndMarkOnLowMemory();
 #if ENABLE_CONCURRENT_GC
     void DoParallelMark();
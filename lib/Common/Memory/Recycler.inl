@@ -130,6 +130,7 @@ Recycler::AllocWithAttributesInlined(DECLSPEC_GUARD_OVERFLOW size_t size)
     TrackAlloc(memBlock, size, trackAllocData, (CUSTOM_CONFIG_ISENABLED(GetRecyclerFlagsTable(), Js::TraceObjectAllocationFlag) && (attributes & TraceBit) == TraceBit));
 #endif
     RecyclerMemoryTracking::ReportAllocation(this, memBlock, size);
+    CountAllocation(size, allocSize);
     RECYCLER_PERF_COUNTER_INC(LiveObject);
     RECYCLER_PERF_COUNTER_ADD(LiveObjectSize, HeapInfo::GetAlignedSizeNoCheck(allocSize));
     RECYCLER_PERF_COUNTER_SUB(FreeObjectSize, HeapInfo::GetAlignedSizeNoCheck(allocSize));
@@ -416,6 +417,9 @@ inline RecyclerWeakReference<T>* Recycler::CreateWeakReferenceHandle(T* pStrongR
 {
     // Return the weak reference that calling Add on the WR map returns
     // The entry returned is recycler-allocated memory
+#if ENABLE_CONCURRENT_GC
+    AutoOptionalCriticalSection autoCS(this->GetWeakReferenceMapCriticalSection());
+#endif
     RecyclerWeakReference<T>* weakRef = (RecyclerWeakReference<T>*) this->weakReferenceMap.Add((char*) pStrongReference, this);
 #if DBG
 #if ENABLE_RECYCLER_TYPE_TRACKING
@@ -436,6 +440,9 @@ inline bool Recycler::FindOrCreateWeakReferenceHandle(T* pStrongReference, Recyc
 {
     // Ensure that the given strong ref has a weak ref in the map.
     // Return a result to indicate whether a new weak ref was created.
+#if ENABLE_CONCURRENT_GC
+    AutoOptionalCriticalSection autoCS(this->GetWeakReferenceMapCriticalSection());
+#endif
     bool ret = this->weakReferenceMap.FindOrAdd((char*) pStrongReference, this, (RecyclerWeakReferenceBase**)ppWeakRef);
 #if DBG
     if (!ret)
@@ -454,6 +461,9 @@ inline bool Recycler::FindOrCreateWeakReferenceHandle(T* pStrongReference, Recyc
 template<typename T>
 inline bool Recycler::TryGetWeakReferenceHandle(T* pStrongReference, RecyclerWeakReference<T> **weakReference)
 {
+#if ENABLE_CONCURRENT_GC
+    AutoOptionalCriticalSection autoCS(this->GetWeakReferenceMapCriticalSection());
+#endif
     return this->weakReferenceMap.TryGetValue((char*) pStrongReference, (RecyclerWeakReferenceBase**)weakReference);
 }
 
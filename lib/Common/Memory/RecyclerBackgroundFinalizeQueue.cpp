@@ -0,0 +1,77 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+
+RecyclerBackgroundFinalizeQueue::RecyclerBackgroundFinalizeQueue() :
+    items(nullptr),
+    count(0),
+    capacity(0)
+{
+}
+
+RecyclerBackgroundFinalizeQueue::~RecyclerBackgroundFinalizeQueue()
+{
+    // Everything queued must have run, otherwise external resources leak
+    Assert(this->count == 0);
+    if (this->items != nullptr)
+    {
+        HeapDeleteArray(this->capacity, this->items);
+    }
+}
+
+bool
+RecyclerBackgroundFinalizeQueue::Add(RecyclerBackgroundFinalizeCallback callback, void * data)
+{
+    Assert(callback != nullptr);
+
+    if (this->count == this->capacity)
+    {
+        uint newCapacity = this->capacity == 0 ? InitialCapacity : this->capacity * 2;
+        Item * newItems = HeapNewNoThrowArray(Item, newCapacity);
+        if (newItems == nullptr)
+        {
+            return false;
+        }
+
+        if (this->items != nullptr)
+        {
+            js_memcpy_s(newItems, newCapacity * sizeof(Item), this->items, this->count * sizeof(Item));
+            HeapDeleteArray(this->capacity, this->items);
+        }
+        this->items = newItems;
+        this->capacity = newCapacity;
+    }
+
+    this->items[this->count].callback = callback;
+    this->items[this->count].data = data;
+    this->count++;
+    return true;
+}
+
+void
+RecyclerBackgroundFinalizeQueue::Run()
+{
+    for (uint i = 0; i < this->count; i++)
+    {
+        this->items[i].callback(this->items[i].data);
+    }
+    this->count = 0;
+}
+
+void
+RecyclerBackgroundFinalizeQueue::Swap(RecyclerBackgroundFinalizeQueue * other)
+{
+    Item * items = this->items;
+    uint count = this->count;
+    uint capacity = this->capacity;
+
+    this->items = other->items;
+    this->count = other->count;
+    this->capacity = other->capacity;
+
+    other->items = items;
+    other->count = count;
+    other->capacity = capacity;
+}
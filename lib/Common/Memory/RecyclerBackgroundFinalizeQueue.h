@@ -0,0 +1,51 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+typedef void (CALLBACK * RecyclerBackgroundFinalizeCallback)(void * data);
+
+/*
+ * RecyclerBackgroundFinalizeQueue holds finalize callbacks that don't depend on the thread they run on,
+ * like freeing external memory or calling a host finalizer that was declared thread-agnostic.
+ * Finalizable objects queue them while they are swept or disposed, instead of running them inline,
+ * and the recycler hands the whole queue to its background finalizer thread in one batch.
+ *
+ * The callbacks get nothing but their data, so they can't touch the GC heap: the objects that
+ * queued them are already freed by the time they run.
+ */
+class RecyclerBackgroundFinalizeQueue
+{
+public:
+    RecyclerBackgroundFinalizeQueue();
+    ~RecyclerBackgroundFinalizeQueue();
+
+    // Returns false if we ran out of memory, the caller should run the callback itself
+    bool Add(RecyclerBackgroundFinalizeCallback callback, void * data);
+
+    // Runs the queued callbacks in order and empties the queue
+    void Run();
+
+    bool IsEmpty() const { return this->count == 0; }
+    uint Count() const { return this->count; }
+
+    // Swaps the contents of the two queues, so a full queue can be handed off without copying it
+    void Swap(RecyclerBackgroundFinalizeQueue * other);
+
+private:
+    static const uint InitialCapacity = 64;
+
+    struct Item
+    {
+        RecyclerBackgroundFinalizeCallback callback;
+        void * data;
+    };
+
+    Item * items;
+    uint count;
+    uint capacity;
+};
+}
@@ -0,0 +1,149 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+
+RecyclerEphemeronTable::RecyclerEphemeronTable(uint size, HeapAllocator * allocator) :
+    allocator(allocator),
+    size(0),
+    count(0),
+    modFunctionIndex(UNKNOWN_MOD_INDEX)
+{
+    this->size = PrimePolicy::GetSize(size, &this->modFunctionIndex);
+    this->buckets = AllocatorNewArrayZ(HeapAllocator, allocator, Entry *, this->size * 2);
+    this->waitBuckets = this->buckets + this->size;
+}
+
+RecyclerEphemeronTable::~RecyclerEphemeronTable()
+{
+    for (uint i = 0; i < this->size; i++)
+    {
+        Entry * entry = this->buckets[i];
+        while (entry != nullptr)
+        {
+            Entry * next = entry->next;
+            AllocatorDelete(HeapAllocator, this->allocator, entry);
+            entry = next;
+        }
+    }
+    AllocatorDeleteArray(HeapAllocator, this->allocator, this->size * 2, this->buckets);
+}
+
+void
+RecyclerEphemeronTable::Set(void * owner, void * key, void * value)
+{
+    uint targetBucket = HashToBucket(owner, key);
+    Entry * entry = FindEntry(owner, key, targetBucket);
+    if (entry != nullptr)
+    {
+        entry->value = value;
+        return;
+    }
+
+    if (this->count > this->size * MaxAverageChainLength)
+    {
+        Resize(this->size * 2);
+        targetBucket = HashToBucket(owner, key);
+    }
+
+    entry = AllocatorNewStruct(HeapAllocator, this->allocator, Entry);
+    entry->owner = owner;
+    entry->key = key;
+    entry->value = value;
+    entry->next = this->buckets[targetBucket];
+    entry->nextWaiting = nullptr;
+    this->buckets[targetBucket] = entry;
+    this->count++;
+}
+
+bool
+RecyclerEphemeronTable::TryGetValue(void * owner, void * key, void ** value) const
+{
+    Entry * entry = FindEntry(owner, key, HashToBucket(owner, key));
+    if (entry == nullptr)
+    {
+        return false;
+    }
+
+    *value = entry->value;
+    return true;
+}
+
+bool
+RecyclerEphemeronTable::Remove(void * owner, void * key)
+{
+    Entry ** pprev = &this->buckets[HashToBucket(owner, key)];
+    for (Entry * entry = *pprev; entry != nullptr; entry = *pprev)
+    {
+        if (entry->owner == owner && entry->key == key)
+        {
+            *pprev = entry->next;
+            AllocatorDelete(HeapAllocator, this->allocator, entry);
+            this->count--;
+            return true;
+        }
+        pprev = &entry->next;
+    }
+    return false;
+}
+
+uint
+RecyclerEphemeronTable::HashToBucket(void * owner, void * key) const
+{
+    return HashToBucket(owner, key, this->size, this->modFunctionIndex);
+}
+
+uint
+RecyclerEphemeronTable::HashObjectToBucket(void * object) const
+{
+    return PrimePolicy::GetBucket(DefaultComparer<void *>::GetHashCode(object), this->size, this->modFunctionIndex);
+}
+
+RecyclerEphemeronTable::Entry *
+RecyclerEphemeronTable::FindEntry(void * owner, void * key, uint targetBucket) const
+{
+    for (Entry * entry = this->buckets[targetBucket]; entry != nullptr; entry = entry->next)
+    {
+        if (entry->owner == owner && entry->key == key)
+        {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+uint
+RecyclerEphemeronTable::HashToBucket(void * owner, void * key, uint size, int modFunctionIndex)
+{
+    // A key is usually in few tables, so mostly hash on the key
+    hash_t hashCode = DefaultComparer<void *>::GetHashCode(key) ^ (DefaultComparer<void *>::GetHashCode(owner) >> 3);
+    return PrimePolicy::GetBucket(hashCode, size, modFunctionIndex);
+}
+
+void
+RecyclerEphemeronTable::Resize(uint capacity)
+{
+    // Don't touch the table until we have the new buckets, in case we run out of memory
+    int newModFunctionIndex = UNKNOWN_MOD_INDEX;
+    uint newSize = PrimePolicy::GetSize(capacity, &newModFunctionIndex);
+    Entry ** newBuckets = AllocatorNewArrayZ(HeapAllocator, this->allocator, Entry *, newSize * 2);
+    for (uint i = 0; i < this->size; i++)
+    {
+        Entry * entry = this->buckets[i];
+        while (entry != nullptr)
+        {
+            Entry * next = entry->next;
+            uint targetBucket = HashToBucket(entry->owner, entry->key, newSize, newModFunctionIndex);
+            entry->next = newBuckets[targetBucket];
+            newBuckets[targetBucket] = entry;
+            entry = next;
+        }
+    }
+
+    AllocatorDeleteArray(HeapAllocator, this->allocator, this->size * 2, this->buckets);
+    this->size = newSize;
+    this->modFunctionIndex = newModFunctionIndex;
+    this->buckets = newBuckets;
+    this->waitBuckets = newBuckets + newSize;
+}
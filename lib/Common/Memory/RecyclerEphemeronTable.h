@@ -0,0 +1,224 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+/*
+ * RecyclerEphemeronTable maps (owner, key) pairs to values that are only kept alive as long as both
+ * the owner and the key are, which is what a WeakMap needs without storing anything on its keys.
+ *
+ * The table lives outside of the GC heap, so marking doesn't find the values through it. Once
+ * marking is done, the recycler marks the values of the entries whose owner and key are marked,
+ * which may in turn mark the owners and keys of other entries, until nothing more gets marked.
+ * Entries are indexed by the object they wait on, so each newly marked object only wakes the
+ * entries keyed on it. The entries whose owner or key didn't survive are removed when the
+ * recycler sweeps.
+ *
+ * The table is only used by the thread that owns the recycler.
+ */
+class RecyclerEphemeronTable
+{
+public:
+    RecyclerEphemeronTable(uint size, HeapAllocator * allocator);
+    ~RecyclerEphemeronTable();
+
+    // Throws on out of memory
+    void Set(void * owner, void * key, void * value);
+    bool TryGetValue(void * owner, void * key, void ** value) const;
+    bool Remove(void * owner, void * key);
+    uint Count() const { return this->count; }
+
+    // Marking the values is a worklist pass. Each entry whose value isn't known to be live yet waits
+    // on the first of its owner and key that isn't marked, in a table indexed by that object, and the
+    // recycler reports each object it marks during the pass with OnObjectMarked, which only wakes the
+    // entries waiting on that object. Objects that get marked without being reported (e.g. leaf
+    // objects, or during a rescan after the mark stack ran out of memory) are picked up by
+    // MarkWaitingValues, which the recycler calls once the mark stack is empty.
+
+    // Marks the values of the entries whose owner and key are marked, and makes the other entries wait.
+    // Returns true if any value was marked.
+    template <typename IsMarkedFn, typename MarkFn>
+    bool BeginMarkValues(IsMarkedFn isMarked, MarkFn markValue)
+    {
+        memset(this->waitBuckets, 0, this->size * sizeof(Entry *));
+
+        Entry * ready = nullptr;
+        for (uint i = 0; i < this->size; i++)
+        {
+            for (Entry * entry = this->buckets[i]; entry != nullptr; entry = entry->next)
+            {
+                if (isMarked(entry->owner) && isMarked(entry->key))
+                {
+                    entry->nextWaiting = ready;
+                    ready = entry;
+                }
+                else
+                {
+                    AddWaiting(entry, isMarked(entry->owner) ? entry->key : entry->owner);
+                }
+            }
+        }
+        return MarkReadyValues(ready, isMarked, markValue);
+    }
+
+    // Wakes the entries waiting on a newly marked object, and marks the values of those whose owner and
+    // key are now both marked
+    template <typename IsMarkedFn, typename MarkFn>
+    void OnObjectMarked(void * object, IsMarkedFn isMarked, MarkFn markValue)
+    {
+        Entry * ready = nullptr;
+        WakeWaiting(object, &ready, isMarked);
+        MarkReadyValues(ready, isMarked, markValue);
+    }
+
+    // Checks every entry that is still waiting, for the objects that got marked without being reported.
+    // Returns true if any value was marked.
+    template <typename IsMarkedFn, typename MarkFn>
+    bool MarkWaitingValues(IsMarkedFn isMarked, MarkFn markValue)
+    {
+        Entry * ready = nullptr;
+        Entry * stillWaiting = nullptr;
+        for (uint i = 0; i < this->size; i++)
+        {
+            Entry * entry = this->waitBuckets[i];
+            this->waitBuckets[i] = nullptr;
+            while (entry != nullptr)
+            {
+                Entry * next = entry->nextWaiting;
+                Entry *& list = (isMarked(entry->owner) && isMarked(entry->key)) ? ready : stillWaiting;
+                entry->nextWaiting = list;
+                list = entry;
+                entry = next;
+            }
+        }
+
+        while (stillWaiting != nullptr)
+        {
+            Entry * entry = stillWaiting;
+            stillWaiting = entry->nextWaiting;
+            AddWaiting(entry, isMarked(entry->owner) ? entry->key : entry->owner);
+        }
+        return MarkReadyValues(ready, isMarked, markValue);
+    }
+
+    // Removes the entries whose owner or key isn't marked. Returns the number of entries removed.
+    template <typename IsMarkedFn>
+    uint Sweep(IsMarkedFn isMarked)
+    {
+        uint removed = 0;
+        for (uint i = 0; i < this->size; i++)
+        {
+            Entry ** pprev = &this->buckets[i];
+            for (Entry * entry = *pprev; entry != nullptr; entry = *pprev)
+            {
+                if (isMarked(entry->owner) && isMarked(entry->key))
+                {
+                    pprev = &entry->next;
+                    continue;
+                }
+
+                *pprev = entry->next;
+                AllocatorDelete(HeapAllocator, this->allocator, entry);
+                removed++;
+            }
+        }
+
+        Assert(removed <= this->count);
+        this->count -= removed;
+        return removed;
+    }
+
+private:
+    static const int MaxAverageChainLength = 1;
+
+    struct Entry
+    {
+        void * owner;
+        void * key;
+        void * value;
+        Entry * next;
+
+        // Only used while marking, links the entries waiting on the same bucket, or the ones ready to mark
+        Entry * nextWaiting;
+    };
+
+    void AddWaiting(Entry * entry, void * object)
+    {
+        uint targetBucket = HashObjectToBucket(object);
+        entry->nextWaiting = this->waitBuckets[targetBucket];
+        this->waitBuckets[targetBucket] = entry;
+    }
+
+    template <typename IsMarkedFn>
+    void WakeWaiting(void * object, Entry ** ready, IsMarkedFn isMarked)
+    {
+        // The object is the owner or key of every entry woken here, so it's a recycler object. Entries
+        // that still wait on the other one of the two are put back once we are done with this bucket.
+        Entry * stillWaiting = nullptr;
+        Entry ** pprev = &this->waitBuckets[HashObjectToBucket(object)];
+        for (Entry * entry = *pprev; entry != nullptr; entry = *pprev)
+        {
+            if (entry->owner != object && entry->key != object)
+            {
+                pprev = &entry->nextWaiting;
+                continue;
+            }
+
+            *pprev = entry->nextWaiting;
+            if (isMarked(entry->owner) && isMarked(entry->key))
+            {
+                entry->nextWaiting = *ready;
+                *ready = entry;
+            }
+            else
+            {
+                entry->nextWaiting = stillWaiting;
+                stillWaiting = entry;
+            }
+        }
+
+        while (stillWaiting != nullptr)
+        {
+            Entry * entry = stillWaiting;
+            stillWaiting = entry->nextWaiting;
+            AddWaiting(entry, isMarked(entry->owner) ? entry->key : entry->owner);
+        }
+    }
+
+    template <typename IsMarkedFn, typename MarkFn>
+    bool MarkReadyValues(Entry * ready, IsMarkedFn isMarked, MarkFn markValue)
+    {
+        bool markedValue = false;
+        while (ready != nullptr)
+        {
+            Entry * entry = ready;
+            ready = entry->nextWaiting;
+            entry->nextWaiting = nullptr;
+
+            markValue(entry->value);
+            markedValue = true;
+
+            // A value that is itself the owner or key of other entries (e.g. chained WeakMaps) wakes them
+            // right away, whether or not it gets scanned
+            WakeWaiting(entry->value, &ready, isMarked);
+        }
+        return markedValue;
+    }
+
+    Entry * FindEntry(void * owner, void * key, uint targetBucket) const;
+    uint HashToBucket(void * owner, void * key) const;
+    uint HashObjectToBucket(void * object) const;
+    static uint HashToBucket(void * owner, void * key, uint size, int modFunctionIndex);
+    void Resize(uint capacity);
+
+    HeapAllocator * allocator;
+    Entry ** buckets;
+    Entry ** waitBuckets;               // Same size as buckets, allocated right after them
+    uint size;
+    uint count;
+    int modFunctionIndex;
+};
+}
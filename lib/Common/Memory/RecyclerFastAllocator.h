@@ -64,6 +64,7 @@ public:
         recycler->TrackAlloc(memBlock, sizeof(T), trackAllocData);
 #endif
         RecyclerMemoryTracking::ReportAllocation(this->recycler, memBlock, sizeof(T));
+        recycler->CountAllocation(sizeof(T), sizeCat);
         RECYCLER_PERF_COUNTER_INC(LiveObject);
         RECYCLER_PERF_COUNTER_ADD(LiveObjectSize, sizeCat);
         RECYCLER_PERF_COUNTER_SUB(FreeObjectSize, sizeCat);
@@ -0,0 +1,348 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+#include "Common/Int32Math.h"
+#include "DataStructures/List.h"
+#include "Core/JsonStreamWriter.h"
+#include "Memory/RecyclerHeapSnapshotWriter.h"
+
+namespace Memory
+{
+// Node and edge types, as indices into the type lists of the snapshot meta data
+static const uint NodeTypeHidden = 0;
+static const uint NodeTypeObject = 3;
+static const uint NodeTypeSynthetic = 9;
+static const uint EdgeTypeElement = 1;
+static const uint EdgeTypeProperty = 2;
+
+static const size_t NodeFieldCount = 6;
+
+static char const * const SnapshotHeader =
+    "{\"snapshot\":{\"meta\":{"
+    "\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\"],"
+    "\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\",\"native\",\"synthetic\",\"concatenated string\",\"sliced string\"],"
+    "\"string\",\"number\",\"number\",\"number\",\"number\"],"
+    "\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"
+    "\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],\"string_or_number\",\"node\"],"
+    "\"trace_function_info_fields\":[],\"trace_node_fields\":[],\"sample_fields\":[],\"location_fields\":[]},";
+
+THREAD_LOCAL RecyclerHeapSnapshotWriter * RecyclerHeapSnapshotWriter::enumeratingWriter = nullptr;
+
+RecyclerHeapSnapshotWriter::RecyclerHeapSnapshotWriter(Recycler * recycler, JsonStreamWriteCallback writeCallback, void * writeContext) :
+    recycler(recycler),
+    writer(writeCallback, writeContext),
+    objects(&HeapAllocator::Instance),
+    edgeCount(0),
+    rootEdgeCount(0),
+    strings(&HeapAllocator::Instance),
+    stringIndexMap(&HeapAllocator::Instance)
+{
+}
+
+RecyclerHeapSnapshotWriter::~RecyclerHeapSnapshotWriter()
+{
+    Assert(enumeratingWriter != this);
+}
+
+bool
+RecyclerHeapSnapshotWriter::Write()
+{
+    CollectObjects();
+    CountEdges();
+
+    writer.WriteRaw(SnapshotHeader);
+    writer.WriteRaw("\"node_count\":");
+    writer.WriteNumber(objects.Count() + 1);
+    writer.WriteRaw(",\"edge_count\":");
+    writer.WriteNumber(edgeCount + rootEdgeCount);
+    writer.WriteRaw(",\"trace_function_count\":0},\n\"nodes\":[");
+    WriteNodes();
+    writer.WriteRaw("],\n\"edges\":[");
+    WriteEdges();
+    writer.WriteRaw("],\n\"trace_function_infos\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\n\"strings\":[");
+    WriteStrings();
+    writer.WriteRaw("]}\n");
+    return writer.Flush();
+}
+
+void
+RecyclerHeapSnapshotWriter::AddObjectCallback(void * address, size_t size)
+{
+    RecyclerHeapSnapshotWriter * writer = enumeratingWriter;
+    Assert(writer != nullptr);
+
+    RecyclerHeapObjectInfo heapObject;
+    if (!writer->recycler->FindHeapObject(address, FindHeapObjectFlags_NoFreeBitVerify, heapObject))
+    {
+        Assert(false);
+        return;
+    }
+
+    ObjectInfoBits attributes = heapObject.GetAttributes();
+    if ((attributes & PendingDisposeBit) != 0)
+    {
+        // Already dead, just waiting for its dispose
+        return;
+    }
+
+    ObjectEntry entry;
+    entry.address = address;
+    entry.size = size;
+    entry.edgeCount = 0;
+    entry.flags = heapObject.IsLeaf() ? ObjectFlags_None : ObjectFlags_Scan;
+    if ((attributes & FinalizeBit) != 0)
+    {
+        entry.flags |= ObjectFlags_Finalizable;
+    }
+    if ((attributes & ImplicitRootBit) != 0)
+    {
+        entry.flags |= ObjectFlags_Root;
+    }
+    writer->objects.Add(entry);
+}
+
+int __cdecl
+RecyclerHeapSnapshotWriter::CompareObjectAddress(void * context, const void * a, const void * b)
+{
+    void * addressA = ((ObjectEntry const *)a)->address;
+    void * addressB = ((ObjectEntry const *)b)->address;
+    return addressA < addressB ? -1 : (addressA > addressB ? 1 : 0);
+}
+
+void
+RecyclerHeapSnapshotWriter::CollectObjects()
+{
+    Assert(enumeratingWriter == nullptr);
+    {
+        AutoRestoreValue<RecyclerHeapSnapshotWriter *> autoEnumeratingWriter(&enumeratingWriter, this);
+
+        // NoBit enumerates every object regardless of its attributes
+        recycler->EnumerateObjects(NoBit, &RecyclerHeapSnapshotWriter::AddObjectCallback);
+    }
+
+    // Sort the objects so the references found in them can be mapped back to nodes
+    objects.Sort(&RecyclerHeapSnapshotWriter::CompareObjectAddress, nullptr);
+
+    auto markPinned = [&](void * address)
+    {
+        int index = FindObjectIndex(address);
+        if (index >= 0)
+        {
+            objects.Item(index).flags |= ObjectFlags_Root;
+        }
+    };
+    if (recycler->transientPinnedObject != nullptr)
+    {
+        markPinned(recycler->transientPinnedObject);
+    }
+    recycler->pinnedObjectMap.Map([&](void * address, Recycler::PinRecord const& refCount)
+    {
+        if (refCount != 0)
+        {
+            markPinned(address);
+        }
+    });
+}
+
+void
+RecyclerHeapSnapshotWriter::CountEdges()
+{
+    for (int i = 0; i < objects.Count(); i++)
+    {
+        ObjectEntry& entry = objects.Item(i);
+        ForEachReference(entry, [&](char16 const * name, size_t slot, int target)
+        {
+            entry.edgeCount++;
+            if (target != i)
+            {
+                objects.Item(target).flags |= ObjectFlags_Referenced;
+            }
+        });
+        edgeCount += entry.edgeCount;
+    }
+
+    for (int i = 0; i < objects.Count(); i++)
+    {
+        if (IsRoot(objects.Item(i)))
+        {
+            rootEdgeCount++;
+        }
+    }
+}
+
+int
+RecyclerHeapSnapshotWriter::FindObjectIndex(void * candidate) const
+{
+    int low = 0;
+    int high = objects.Count() - 1;
+    while (low <= high)
+    {
+        int mid = low + (high - low) / 2;
+        void * address = objects.Item(mid).address;
+        if (address == candidate)
+        {
+            return mid;
+        }
+        if (address < candidate)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+    return -1;
+}
+
+bool
+RecyclerHeapSnapshotWriter::IsRoot(ObjectEntry const& entry) const
+{
+    return (entry.flags & (ObjectFlags_Root | ObjectFlags_Referenced)) != ObjectFlags_Referenced;
+}
+
+template <typename Fn>
+void CALLBACK
+RecyclerHeapSnapshotWriter::NamedReferenceCallback(void * context, char16 const * name, void * reference)
+{
+    (*(Fn *)context)(name, reference);
+}
+
+template <typename Fn>
+void
+RecyclerHeapSnapshotWriter::ForEachReference(ObjectEntry const& entry, Fn fn)
+{
+    auto namedReference = [&](char16 const * name, void * reference)
+    {
+        int target = this->FindObjectIndex(reference);
+        if (target >= 0)
+        {
+            fn(name, 0, target);
+        }
+    };
+    recycler->collectionWrapper->ForEachHeapSnapshotReference(entry.address, entry.size,
+        &RecyclerHeapSnapshotWriter::NamedReferenceCallback<decltype(namedReference)>, &namedReference);
+
+    if ((entry.flags & ObjectFlags_Scan) == 0)
+    {
+        return;
+    }
+
+    // Same as the mark, anything that looks like a pointer to an object is a reference
+    void ** slots = (void **)entry.address;
+    size_t slotCount = entry.size / sizeof(void *);
+    for (size_t slot = 0; slot < slotCount; slot++)
+    {
+        int target = this->FindObjectIndex(slots[slot]);
+        if (target >= 0)
+        {
+            fn(nullptr, slot, target);
+        }
+    }
+}
+
+void
+RecyclerHeapSnapshotWriter::WriteNodes()
+{
+    // The synthetic root is the first node
+    writer.WriteNumber(NodeTypeSynthetic);
+    writer.WriteChar(',');
+    writer.WriteNumber(GetStringIndex(_u("(GC roots)")));
+    writer.WriteRaw(",1,0,");
+    writer.WriteNumber(rootEdgeCount);
+    writer.WriteRaw(",0");
+
+    for (int i = 0; i < objects.Count(); i++)
+    {
+        ObjectEntry const& entry = objects.Item(i);
+        uint type = NodeTypeObject;
+        char16 const * name = recycler->collectionWrapper->GetHeapSnapshotObjectName(entry.address, entry.size);
+        if (name == nullptr)
+        {
+            type = NodeTypeHidden;
+            name = (entry.flags & ObjectFlags_Finalizable) != 0 ? _u("(recycler finalizable)") :
+                (entry.flags & ObjectFlags_Scan) != 0 ? _u("(recycler object)") : _u("(recycler leaf)");
+        }
+
+        writer.WriteRaw(",\n");
+        writer.WriteNumber(type);
+        writer.WriteChar(',');
+        writer.WriteNumber(GetStringIndex(name));
+        writer.WriteChar(',');
+        writer.WriteNumber(((size_t)i + 1) * 2 + 1);
+        writer.WriteChar(',');
+        writer.WriteNumber(entry.size);
+        writer.WriteChar(',');
+        writer.WriteNumber(entry.edgeCount);
+        writer.WriteRaw(",0");
+    }
+}
+
+void
+RecyclerHeapSnapshotWriter::WriteEdges()
+{
+    bool first = true;
+    auto writeEdge = [&](uint type, size_t nameOrIndex, int target)
+    {
+        writer.WriteRaw(first ? "\n" : ",\n");
+        first = false;
+        writer.WriteNumber(type);
+        writer.WriteChar(',');
+        writer.WriteNumber(nameOrIndex);
+        writer.WriteChar(',');
+        writer.WriteNumber(((size_t)target + 1) * NodeFieldCount);
+    };
+
+    size_t rootIndex = 0;
+    for (int i = 0; i < objects.Count(); i++)
+    {
+        if (IsRoot(objects.Item(i)))
+        {
+            writeEdge(EdgeTypeElement, rootIndex++, i);
+        }
+    }
+    Assert(rootIndex == rootEdgeCount);
+
+    for (int i = 0; i < objects.Count(); i++)
+    {
+        ForEachReference(objects.Item(i), [&](char16 const * name, size_t slot, int target)
+        {
+            if (name != nullptr)
+            {
+                writeEdge(EdgeTypeProperty, GetStringIndex(name), target);
+            }
+            else
+            {
+                writeEdge(EdgeTypeElement, slot, target);
+            }
+        });
+    }
+}
+
+void
+RecyclerHeapSnapshotWriter::WriteStrings()
+{
+    for (int i = 0; i < strings.Count(); i++)
+    {
+        writer.WriteRaw(i == 0 ? "\n" : ",\n");
+        writer.WriteString(strings.Item(i));
+    }
+}
+
+uint
+RecyclerHeapSnapshotWriter::GetStringIndex(char16 const * string)
+{
+    uint index;
+    if (stringIndexMap.TryGetValue(string, &index))
+    {
+        return index;
+    }
+
+    index = (uint)strings.Count();
+    strings.Add(string);
+    stringIndexMap.Add(string, index);
+    return index;
+}
+}
@@ -0,0 +1,85 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+/*
+ * RecyclerHeapSnapshotWriter streams the recycler heap out in the .heapsnapshot JSON format, which
+ * the browser developer tools and other heap analysis tools load. Unlike RecyclerObjectGraphDumper,
+ * it doesn't depend on any debug only tracking, so it can be used to look at leaks in production.
+ *
+ * Every allocated object becomes a node. The edges come from scanning the non-leaf objects
+ * conservatively for pointers to the start of other objects, plus the named references reported by
+ * the collection wrapper, like the properties of the JavaScript objects. The collection wrapper
+ * names the nodes it knows about, the other objects get a name from their attributes.
+ *
+ * The roots of the heap are only known during a mark, so a synthetic root node references the
+ * pinned objects, the implicit roots and every object that no other object references. A cycle
+ * only kept alive from the stack shows up as unreachable.
+ *
+ * The writer doesn't allocate from the recycler, so the heap doesn't change between its passes.
+ */
+class RecyclerHeapSnapshotWriter
+{
+public:
+    RecyclerHeapSnapshotWriter(Recycler * recycler, JsonStreamWriteCallback writeCallback, void * writeContext);
+    ~RecyclerHeapSnapshotWriter();
+
+    // Returns false if the write callback failed. Throws if we run out of memory.
+    bool Write();
+
+private:
+    enum ObjectFlags : byte
+    {
+        ObjectFlags_None        = 0x0,
+        ObjectFlags_Scan        = 0x1,
+        ObjectFlags_Finalizable = 0x2,
+        ObjectFlags_Root        = 0x4,
+        ObjectFlags_Referenced  = 0x8,
+    };
+
+    struct ObjectEntry
+    {
+        void * address;
+        size_t size;
+        uint edgeCount;
+        byte flags;
+    };
+
+    static void AddObjectCallback(void * address, size_t size);
+    static int __cdecl CompareObjectAddress(void * context, const void * a, const void * b);
+    template <typename Fn>
+    static void CALLBACK NamedReferenceCallback(void * context, char16 const * name, void * reference);
+
+    void CollectObjects();
+    void CountEdges();
+    int FindObjectIndex(void * candidate) const;
+    bool IsRoot(ObjectEntry const& entry) const;
+    template <typename Fn>
+    void ForEachReference(ObjectEntry const& entry, Fn fn);
+
+    void WriteNodes();
+    void WriteEdges();
+    void WriteStrings();
+    uint GetStringIndex(char16 const * string);
+
+    Recycler * recycler;
+    JsonStreamWriteCallback writeCallback;
+    void * writeContext;
+    bool writeFailed;
+
+    JsUtil::List<ObjectEntry, HeapAllocator> objects;
+    size_t edgeCount;
+    size_t rootEdgeCount;
+
+    JsUtil::List<char16 const *, HeapAllocator> strings;
+    JsUtil::BaseDictionary<char16 const *, uint, HeapAllocator> stringIndexMap;
+
+    // Recycler::EnumerateObjects takes a plain function, so the writer that is collecting the
+    // objects on this thread is found through here
+    THREAD_LOCAL static RecyclerHeapSnapshotWriter * enumeratingWriter;
+};
+}
@@ -80,7 +80,7 @@ RecyclerHeuristic::UncollectedAllocBytesCollection()
 
 #if ENABLE_CONCURRENT_GC
 uint
-RecyclerHeuristic::MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable& flags)
+RecyclerHeuristic::MaxBackgroundFinishMarkCount(DWORD pauseBudget, Js::ConfigFlagsTable& flags)
 {
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     if (flags.IsEnabled(Js::MaxBackgroundFinishMarkCountFlag))
@@ -88,12 +88,18 @@ RecyclerHeuristic::MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable& flags)
         return flags.MaxBackgroundFinishMarkCount;
     }
 #endif
+    if (pauseBudget != 0)
+    {
+        return PauseBudgetMaxBackgroundFinishMarkCount;
+    }
     return DefaultMaxBackgroundFinishMarkCount;
 }
 
 DWORD
-RecyclerHeuristic::BackgroundFinishMarkWaitTime(bool backgroundFinishMarkWaitTime, Js::ConfigFlagsTable& flags)
+RecyclerHeuristic::BackgroundFinishMarkWaitTime(bool backgroundFinishMarkWaitTime, DWORD pauseBudget, Js::ConfigFlagsTable& flags)
 {
+    // A pause budget asks for background finish mark even when the caller didn't
+    backgroundFinishMarkWaitTime = backgroundFinishMarkWaitTime || pauseBudget != 0;
     if (RECYCLER_HEURISTIC_VERSION == 10)
     {
         backgroundFinishMarkWaitTime = backgroundFinishMarkWaitTime && CUSTOM_PHASE_ON1(flags, Js::BackgroundFinishMarkPhase);
@@ -116,6 +122,10 @@ RecyclerHeuristic::BackgroundFinishMarkWaitTime(bool backgroundFinishMarkWaitTim
     {
         return INFINITE;
     }
+    if (pauseBudget != 0)
+    {
+        return min(pauseBudget, DefaultBackgroundFinishMarkWaitTime);
+    }
     return DefaultBackgroundFinishMarkWaitTime;
 }
 
@@ -143,6 +153,18 @@ RecyclerHeuristic::FinishConcurrentCollectWaitTime(Js::ConfigFlagsTable& flags)
     return DefaultFinishConcurrentCollectWaitTime;
 }
 
+DWORD
+RecyclerHeuristic::FinishConcurrentCollectWaitTime(DWORD pauseBudget, Js::ConfigFlagsTable& flags)
+{
+    DWORD waitTime = FinishConcurrentCollectWaitTime(flags);
+    if (pauseBudget != 0)
+    {
+        // Go back to script if the background thread isn't done within the budget, we will try again later
+        return min(pauseBudget, waitTime);
+    }
+    return waitTime;
+}
+
 
 DWORD
 RecyclerHeuristic::PriorityBoostTimeout(Js::ConfigFlagsTable& flags)
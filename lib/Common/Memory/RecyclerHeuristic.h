@@ -37,10 +37,11 @@ public:
     // Constant heuristic that may be changed by switches
     static uint UncollectedAllocBytesCollection();
 #if ENABLE_CONCURRENT_GC
-    static uint MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable&);
-    static DWORD BackgroundFinishMarkWaitTime(bool, Js::ConfigFlagsTable&);
+    static uint MaxBackgroundFinishMarkCount(DWORD pauseBudget, Js::ConfigFlagsTable&);
+    static DWORD BackgroundFinishMarkWaitTime(bool, DWORD pauseBudget, Js::ConfigFlagsTable&);
     static size_t MinBackgroundRepeatMarkRescanBytes(Js::ConfigFlagsTable&);
     static DWORD FinishConcurrentCollectWaitTime(Js::ConfigFlagsTable&);
+    static DWORD FinishConcurrentCollectWaitTime(DWORD pauseBudget, Js::ConfigFlagsTable&);
     static DWORD PriorityBoostTimeout(Js::ConfigFlagsTable&);
 #endif
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
@@ -74,6 +75,11 @@ private:
     static const DWORD DefaultFinishConcurrentCollectWaitTime = 1000;                       // 1 second
     static const uint DefaultMaxBackgroundFinishMarkCount = 1;
     static const DWORD DefaultBackgroundFinishMarkWaitTime = 15; // ms
+
+    // With a pause budget, the rescan is retried in the background a few more times, one budget
+    // long wait each, before we give up and finish marking in thread. That last in-thread rescan
+    // isn't bounded, so the budget is best effort.
+    static const uint PauseBudgetMaxBackgroundFinishMarkCount = 4;
     static const size_t DefaultMinBackgroundRepeatMarkRescanBytes = 1 MEGABYTES;
 #endif
 };
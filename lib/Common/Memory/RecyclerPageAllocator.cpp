@@ -26,6 +26,29 @@ bool RecyclerPageAllocator::IsMemProtectMode()
     return recycler->IsMemProtectMode();
 }
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+void
+RecyclerPageAllocator::EnableHugePages()
+{
+    Assert(segments.Empty());
+    Assert(fullSegments.Empty());
+    Assert(emptySegments.Empty());
+    Assert(decommitSegments.Empty());
+    Assert(largeSegments.Empty());
+    CompileAssert(HugePageSegmentPageCount <= PageSegment::MaxDataPageCount);
+
+    // Aligned segments cover whole L2 chunks of the HeapBlockMap, so a segment never
+    // shares a chunk (and its mark bits) with another one, nor straddles a 64-bit map node.
+    CompileAssert(HugePageSegmentPageCount % HeapBlockMap32::L2Count == 0);
+
+    // Each page segment is then exactly one 2MB aligned huge page. Guard pages
+    // would move the segment off the alignment, so they are left out.
+    allocFlags |= MEM_RESERVE_HUGEPAGES;
+    maxAllocPageCount = HugePageSegmentPageCount;
+    excludeGuardPages = true;
+}
+#endif
+
 #if ENABLE_CONCURRENT_GC
 #ifdef RECYCLER_WRITE_WATCH
 void
@@ -20,6 +20,11 @@ public:
 
     static uint const DefaultPrimePageCount = 0x1000; // 16MB
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    static uint const HugePageSegmentPageCount = 512; // 2MB
+    void EnableHugePages();
+#endif
+
 #if ENABLE_CONCURRENT_GC
 #ifdef RECYCLER_WRITE_WATCH
 #if DBG
@@ -23,6 +23,10 @@ static const uint MaxUnusedPartialCollectFreeBytes = 16 MEGABYTES;
 static const double MinPartialCollectEfficacy = 0.1;
 #endif
 
+#if DBG
+THREAD_LOCAL RecyclerVerifyListConsistencyData * RecyclerSweep::threadVerifyListConsistencyData = nullptr;
+#endif
+
 bool
 RecyclerSweep::IsMemProtectMode()
 {
@@ -215,6 +219,22 @@ RecyclerSweep::FinishSweep()
                     RECYCLER_PROFILE_EXEC_END(recycler, Js::ResetWriteWatchPhase);
                 }
             }
+#endif
+#ifdef RECYCLER_WRITE_BARRIER
+#ifdef RECYCLER_WRITE_WATCH
+            // With write watch, the pages were reset above and the cards aren't used to find dirty pages
+            bool resetWriteBarrier = CONFIG_FLAG(ForceSoftwareWriteBarrier);
+#else
+            bool resetWriteBarrier = true;
+#endif
+            if (resetWriteBarrier && !this->IsBackground())
+            {
+                // Every dirty card has been rescanned by now. Clear them so the next partial collect
+                // only rescans the pages written to since this one.
+                RECYCLER_PROFILE_EXEC_BEGIN(recycler, Js::ResetWriteWatchPhase);
+                recycler->heapBlockMap.ResetWriteBarrierDirtyPages(recycler);
+                RECYCLER_PROFILE_EXEC_END(recycler, Js::ResetWriteWatchPhase);
+            }
 #endif
         }
         else
@@ -798,6 +818,13 @@ template <typename TBlockAttributes>
 void
 RecyclerSweep::NotifyAllocableObjects(SmallHeapBlockT<TBlockAttributes> * heapBlock)
 {
+    // The reuse counts only feed the partial collect heuristics. Outside of partial collect mode
+    // the buckets may be swept in parallel, so don't touch them at all.
+    if (!recycler->inPartialCollectMode)
+    {
+        return;
+    }
+
     this->reuseByteCount += heapBlock->GetExpectedFreeBytes();
 
     if (!heapBlock->IsLeafBlock())
@@ -26,6 +26,17 @@ public:
     bool IsBackground() const;
     bool HasSetupBackgroundSweep() const;
     void FlushPendingTransferDisposedObjects();
+#if DBG
+    // Buckets swept on the parallel threads verify their lists with the thread's own consistency data
+    RecyclerVerifyListConsistencyData& GetVerifyListConsistencyData()
+    {
+        return threadVerifyListConsistencyData != nullptr ? *threadVerifyListConsistencyData : *this;
+    }
+    static void SetThreadVerifyListConsistencyData(RecyclerVerifyListConsistencyData * verifyListConsistencyData)
+    {
+        threadVerifyListConsistencyData = verifyListConsistencyData;
+    }
+#endif
 
 #if ENABLE_CONCURRENT_GC
     bool HasPendingSweepSmallHeapBlocks() const;
@@ -144,6 +155,10 @@ private:
 private:
     bool IsMemProtectMode();
 
+#if DBG
+    THREAD_LOCAL static RecyclerVerifyListConsistencyData * threadVerifyListConsistencyData;
+#endif
+
     Recycler * recycler;
     Data<SmallLeafHeapBlock> leafData;
     Data<SmallNormalHeapBlock> normalData;
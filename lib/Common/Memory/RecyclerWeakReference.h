@@ -115,13 +115,24 @@ class WeakReferenceHashTable
     RecyclerWeakReferenceBase* freeList;
     int modFunctionIndex;
 
+    // Entries that the concurrent part of the sweep couldn't prove alive, see CollectSweepCandidates
+    static const uint InitialSweepCandidateCapacity = 64;
+    RecyclerWeakReferenceBase** sweepCandidates;
+    uint sweepCandidateCount;
+    uint sweepCandidateCapacity;
+    bool hasSweepCandidates;
+
 public:
     WeakReferenceHashTable(uint size, HeapAllocator* allocator):
         count(0),
         size(0),
         modFunctionIndex(UNKNOWN_MOD_INDEX),
         allocator(allocator),
-        freeList(nullptr)
+        freeList(nullptr),
+        sweepCandidates(nullptr),
+        sweepCandidateCount(0),
+        sweepCandidateCapacity(0),
+        hasSweepCandidates(false)
     {
         this->size = SizePolicy::GetSize(size, &modFunctionIndex);
         buckets = AllocatorNewArrayZ(HeapAllocator, allocator, RecyclerWeakReferenceBase*, this->size);
@@ -130,6 +141,10 @@ public:
     ~WeakReferenceHashTable()
     {
         AllocatorDeleteArray(HeapAllocator, allocator,  size, buckets);
+        if (sweepCandidates != nullptr)
+        {
+            AllocatorDeleteArray(HeapAllocator, allocator, sweepCandidateCapacity, sweepCandidates);
+        }
     }
 
     RecyclerWeakReferenceBase* Add(char* strongReference, Recycler * recycler)
@@ -263,6 +278,56 @@ public:
 #endif
     }
 
+    // Concurrent part of the sweep: remember the entries that isLive can't vouch for, so that the sweep
+    // only has to look at those and at the entries created from now on. If we run out of memory, there
+    // are no candidates and the sweep goes through the whole table.
+    template <class Func>
+    void CollectSweepCandidates(Func isLive)
+    {
+        ClearSweepCandidates();
+        this->hasSweepCandidates = true;
+
+        for (uint i = 0; i < size; i++)
+        {
+            for (RecyclerWeakReferenceBase * current = buckets[i]; current != nullptr; current = current->next)
+            {
+                if (!isLive(current) && !AddSweepCandidate(current))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    bool HasSweepCandidates() const { return this->hasSweepCandidates; }
+
+    void ClearSweepCandidates()
+    {
+        this->sweepCandidateCount = 0;
+        this->hasSweepCandidates = false;
+    }
+
+    // Like Map, but only for the sweep candidates
+    template <class Func>
+    void MapSweepCandidates(Func fn)
+    {
+        Assert(this->hasSweepCandidates);
+
+        for (uint i = 0; i < sweepCandidateCount; i++)
+        {
+            RecyclerWeakReferenceBase * candidate = sweepCandidates[i];
+
+            // fn may clear the strong reference, find the bucket first
+            uint targetBucket = HashKeyToBucket(candidate->strongRef, size);
+            if (!fn(candidate))
+            {
+                RemoveEntry(candidate, targetBucket);
+            }
+        }
+
+        ClearSweepCandidates();
+    }
+
 private:
     // If density is a compile-time constant, then we can optimize (avoids division)
     // Sometimes the compiler can also make this optimization, but this way is guaranteed.
@@ -298,6 +363,47 @@ private:
         (*bucket) = entry;
     }
 
+    void RemoveEntry(RecyclerWeakReferenceBase* entry, uint targetBucket)
+    {
+        RecyclerWeakReferenceBase ** pprev = &buckets[targetBucket];
+        for (RecyclerWeakReferenceBase * current = *pprev; current != nullptr; current = *pprev)
+        {
+            if (current == entry)
+            {
+                *pprev = current->next;
+                count--;
+                return;
+            }
+            pprev = &current->next;
+        }
+        Assert(false);
+    }
+
+    bool AddSweepCandidate(RecyclerWeakReferenceBase* entry)
+    {
+        if (sweepCandidateCount == sweepCandidateCapacity)
+        {
+            uint newCapacity = sweepCandidateCapacity == 0 ? InitialSweepCandidateCapacity : sweepCandidateCapacity * 2;
+            RecyclerWeakReferenceBase** newCandidates = AllocatorNewNoThrowArray(HeapAllocator, allocator, RecyclerWeakReferenceBase*, newCapacity);
+            if (newCandidates == nullptr)
+            {
+                ClearSweepCandidates();
+                return false;
+            }
+
+            if (sweepCandidates != nullptr)
+            {
+                js_memcpy_s(newCandidates, newCapacity * sizeof(RecyclerWeakReferenceBase*), sweepCandidates, sweepCandidateCount * sizeof(RecyclerWeakReferenceBase*));
+                AllocatorDeleteArray(HeapAllocator, allocator, sweepCandidateCapacity, sweepCandidates);
+            }
+            sweepCandidates = newCandidates;
+            sweepCandidateCapacity = newCapacity;
+        }
+
+        sweepCandidates[sweepCandidateCount++] = entry;
+        return true;
+    }
+
     void Resize(int newSize)
     {
 #if DEBUG
@@ -359,6 +465,13 @@ private:
 #endif
         AddEntry(entry, &buckets[targetBucket]);
         count++;
+
+        if (this->hasSweepCandidates)
+        {
+            // The concurrent part of the sweep didn't see this entry. If we can't remember it, the sweep
+            // will go through the whole table instead.
+            AddSweepCandidate(entry);
+        }
 #if DBG
 #if ENABLE_RECYCLER_TYPE_TRACKING
         entry->typeInfo = nullptr;
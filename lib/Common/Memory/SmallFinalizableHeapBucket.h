@@ -381,6 +381,15 @@ public:
     void ScanNewImplicitRoots(Recycler * recycler);
 
     void Sweep(RecyclerSweep& recyclerSweep);
+#if ENABLE_CONCURRENT_GC
+    // The buckets swept by Sweep are independent of each other and can be swept on different threads
+#ifdef RECYCLER_WRITE_BARRIER
+    static const uint SweepBucketCount = 3;
+#else
+    static const uint SweepBucketCount = 2;
+#endif
+    void SweepBucket(RecyclerSweep& recyclerSweep, uint index);
+#endif
     uint Rescan(Recycler * recycler, RescanFlags flags);
 #if ENABLE_CONCURRENT_GC
     void SweepPendingObjects(RecyclerSweep& recyclerSweep);
@@ -10,7 +10,8 @@ SmallHeapBlockAllocator<TBlockType>::SmallHeapBlockAllocator() :
     endAddress(nullptr),
     heapBlock(nullptr),
     prev(nullptr),
-    next(nullptr)
+    next(nullptr),
+    isPretenured(false)
 {
 #ifdef RECYCLER_TRACK_NATIVE_ALLOCATED_OBJECTS
     this->lastNonNativeBumpAllocatedBlock = nullptr;
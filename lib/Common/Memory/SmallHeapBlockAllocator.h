@@ -66,6 +66,10 @@ public:
     {
         return !IsBumpAllocMode() && !IsExplicitFreeObjectListAllocMode();
     }
+
+    // A pretenured allocator only allocates from new heap blocks, which no other allocator takes
+    void SetIsPretenured() { this->isPretenured = true; }
+    bool IsPretenured() const { return this->isPretenured; }
 private:
     static bool NeedSetAttributes(ObjectInfoBits attributes)
     {
@@ -78,6 +82,7 @@ private:
 
     SmallHeapBlockAllocator * prev;
     SmallHeapBlockAllocator * next;
+    bool isPretenured;
 
     friend class HeapBucketT<BlockType>;
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
@@ -0,0 +1,105 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+// Fixed capacity lock-free work stealing deque, after Chase and Lev's "Dynamic Circular Work-Stealing Deque".
+// The owning thread pushes and pops at the bottom, and only needs to synchronize with other threads
+// when it pops the last item. Any other thread may steal from the top.
+// Unlike the original algorithm, the buffer doesn't grow: PushBottom fails when the deque is full
+// and the owner is expected to hold on to the item itself.
+template <typename T, uint Capacity>
+class WorkStealingDeque
+{
+    CompileAssert((Capacity & (Capacity - 1)) == 0);
+
+public:
+    WorkStealingDeque() : top(0), bottom(0)
+    {
+    }
+
+    bool IsEmpty() const
+    {
+        return this->bottom <= this->top;
+    }
+
+    // Only called by the owning thread.
+    bool PushBottom(T item)
+    {
+        LONG b = this->bottom;
+        LONG t = this->top;
+        if (b - t >= (LONG)Capacity)
+        {
+            return false;
+        }
+
+        this->items[b & (Capacity - 1)] = item;
+
+        // The item needs to be visible before a thief can see the new bottom
+        MemoryBarrier();
+        this->bottom = b + 1;
+        return true;
+    }
+
+    // Only called by the owning thread.
+    bool PopBottom(T * item)
+    {
+        LONG b = this->bottom - 1;
+        this->bottom = b;
+
+        // Publish the new bottom before reading top, so that we and a thief can't both take the last item
+        MemoryBarrier();
+        LONG t = this->top;
+
+        if (b < t)
+        {
+            // Empty
+            this->bottom = t;
+            return false;
+        }
+
+        *item = this->items[b & (Capacity - 1)];
+        if (b > t)
+        {
+            // More than one item left, no thief can be contending for this one
+            return true;
+        }
+
+        // Last item. Race the thieves for it by advancing top.
+        bool won = (InterlockedCompareExchange(&this->top, t + 1, t) == t);
+        this->bottom = t + 1;
+        return won;
+    }
+
+    // Called by any thread other than the owner.
+    bool Steal(T * item)
+    {
+        LONG t = this->top;
+        MemoryBarrier();
+        LONG b = this->bottom;
+
+        if (t >= b)
+        {
+            return false;
+        }
+
+        T stolenItem = this->items[t & (Capacity - 1)];
+        if (InterlockedCompareExchange(&this->top, t + 1, t) != t)
+        {
+            // Lost the race to the owner or another thief
+            return false;
+        }
+
+        *item = stolenItem;
+        return true;
+    }
+
+private:
+    volatile LONG top;
+    volatile LONG bottom;
+    T items[Capacity];
+};
+}
@@ -239,6 +239,13 @@ typedef struct ArrayCallSiteIDL
 #endif
 } ArrayCallSiteIDL;
 
+typedef struct AllocationSiteIDL
+{
+    unsigned short allocationsUntilSample;
+    byte survivedSampleCount;
+    byte diedSampleCount;
+} AllocationSiteIDL;
+
 typedef struct LdElemIDL
 {
     unsigned short arrayType;
@@ -275,6 +282,8 @@ typedef struct ProfileDataIDL
 
     unsigned int inlineCacheCount;
     unsigned int loopCount;
+    unsigned int allocationSiteCount;
+    X64_PAD4(1)
 
     BVFixedIDL * loopFlags;
 
@@ -301,6 +310,8 @@ typedef struct ProfileDataIDL
 
     IDL_DEF([size_is(loopCount)]) byte * loopImplicitCallFlags;
 
+    IDL_DEF([size_is(allocationSiteCount)]) AllocationSiteIDL * allocationSiteData;
+
     CHAKRA_PTR arrayCallSiteDataAddr;
     CHAKRA_PTR fldDataAddr;
     __int64 flags;
@@ -443,7 +443,20 @@ typedef unsigned short uint16_t;
         ///     Calling <c>JsSetException</c> will also dispatch the exception to the script debugger
         ///     (if any) giving the debugger a chance to break on the exception.
         /// </summary>
-        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040
+        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040,
+        /// <summary>
+        ///     The runtime will reserve its garbage collected heap in 2MB aligned segments backed by
+        ///     transparent huge pages, which reduces TLB misses on large heaps at the cost of a coarser
+        ///     memory footprint. Only has an effect on 64-bit Linux.
+        /// </summary>
+        JsRuntimeAttributeEnableHugePages = 0x00000080,
+        /// <summary>
+        ///     The host's finalize callbacks for external objects and external array buffers may be
+        ///     called on a background thread, in batches after a garbage collection, instead of on the
+        ///     runtime's thread while it sweeps. The callbacks must not call back into the runtime.
+        ///     Has no effect when background work is disabled.
+        /// </summary>
+        JsRuntimeAttributeEnableBackgroundFinalize = 0x00000100
     } JsRuntimeAttributes;
 
     /// <summary>
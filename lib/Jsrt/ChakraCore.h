@@ -791,5 +791,360 @@ JsLessThanOrEqual(
     _In_ JsValueRef object2,
     _Out_ bool *result);
 
+/// <summary>
+///     Sets how long a garbage collection may block the runtime's thread.
+/// </summary>
+/// <remarks>
+///     <para>
+///     With a pause budget, when script needs to wait for a concurrent collection to finish marking,
+///     the runtime waits at most the budget and then resumes script, leaving the rest of the marking
+///     to the background thread. Collections that can't be done concurrently, such as the one done by
+///     <c>JsCollectGarbage</c>, are not bounded.
+///     </para>
+///     <para>
+///     The budget is best effort. If the background thread still hasn't finished marking after a few
+///     bounded waits, the runtime finishes marking on its own thread, and that pause isn't bounded.
+///     </para>
+///     <para>
+///     Requires the runtime to not be in use on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to set the pause budget of.</param>
+/// <param name="pauseBudget">The pause budget in milliseconds, or 0 for no budget.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSetRuntimeGCPauseBudget(
+    _In_ JsRuntimeHandle runtime,
+    _In_ unsigned int pauseBudget);
+
+/// <summary>
+///     Gets the histogram of how long garbage collections have blocked the runtime's thread.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Bucket 0 counts the pauses shorter than 128 microseconds, and each following bucket counts
+///     the pauses up to twice as long as the bucket before it: bucket 1 is 128 to 256 microseconds,
+///     bucket 2 is 256 to 512 microseconds and so on. The last of the 16 buckets counts all the
+///     longer pauses. If fewer buckets are requested, only the first ones are filled in.
+///     </para>
+///     <para>
+///     Requires the runtime to not be in use on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to get the pause histogram of.</param>
+/// <param name="pauseCounts">The buffer that receives the pause count of each bucket.</param>
+/// <param name="bucketCount">The number of buckets in the buffer.</param>
+/// <param name="actualBucketCount">The number of buckets the runtime keeps.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetRuntimeGCPauseHistogram(
+    _In_ JsRuntimeHandle runtime,
+    _Out_writes_opt_(bucketCount) unsigned int *pauseCounts,
+    _In_ unsigned int bucketCount,
+    _Out_opt_ unsigned int *actualBucketCount);
+
+/// <summary>
+///     The allocations a runtime made in one size class.
+/// </summary>
+typedef struct JsAllocationHistogramEntry
+{
+    /// <summary>
+    ///     The object size of the size class, or 0 for the allocations too large to have one.
+    /// </summary>
+    unsigned int bucketSize;
+    /// <summary>
+    ///     The number of allocations made in the size class.
+    /// </summary>
+    unsigned long long allocationCount;
+    /// <summary>
+    ///     The bytes asked for by the allocations.
+    /// </summary>
+    unsigned long long requestedBytes;
+    /// <summary>
+    ///     The bytes the allocations actually take up once rounded up to the size class.
+    /// </summary>
+    unsigned long long allocatedBytes;
+} JsAllocationHistogramEntry;
+
+/// <summary>
+///     Starts recording the runtime's allocations by size class.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Recording slows allocation down a little and is off by default. It can also be turned on
+///     for every runtime with the <c>-RecyclerSizeHistogram</c> flag. Objects allocated directly by
+///     jitted code are not recorded.
+///     </para>
+///     <para>
+///     Requires the runtime to not be in use on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to record the allocations of.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsEnableRuntimeAllocationHistogram(
+    _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Gets the runtime's allocations by size class, recorded since
+///     <c>JsEnableRuntimeAllocationHistogram</c> was called.
+/// </summary>
+/// <remarks>
+///     <para>
+///     There is one entry for each small and medium size class, in increasing size order, and a
+///     last entry for the large allocations. The difference between <c>allocatedBytes</c> and
+///     <c>requestedBytes</c> is the memory lost to rounding in that size class. If fewer entries are
+///     requested, only the first ones are filled in.
+///     </para>
+///     <para>
+///     Requires the runtime to not be in use on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to get the allocation histogram of.</param>
+/// <param name="entries">The buffer that receives the entries.</param>
+/// <param name="entryCount">The number of entries in the buffer.</param>
+/// <param name="actualEntryCount">The number of entries the runtime keeps.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the
+///     histogram isn't enabled, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetRuntimeAllocationHistogram(
+    _In_ JsRuntimeHandle runtime,
+    _Out_writes_opt_(entryCount) JsAllocationHistogramEntry *entries,
+    _In_ unsigned int entryCount,
+    _Out_opt_ unsigned int *actualEntryCount);
+
+/// <summary>
+///     Collects garbage and writes a snapshot of the runtime's heap to a file descriptor.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The snapshot is written in the <c>.heapsnapshot</c> JSON format that heap analysis tools
+///     like the browser developer tools load. Every object in the heap is a node, named after its
+///     JavaScript type when it has one. The references between objects are found by scanning them
+///     for pointers, and the references held in JavaScript properties are named after the property.
+///     </para>
+///     <para>
+///     The heap roots aren't tracked outside of a collection, so a synthetic root node references
+///     the pinned objects and every object no other object references.
+///     </para>
+///     <para>
+///     The file descriptor is written to from the calling thread and is left open.
+///     </para>
+///     <para>
+///     Requires the runtime to not be in use on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to write the heap snapshot of.</param>
+/// <param name="fd">The file descriptor to write the snapshot to.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the
+///     file descriptor couldn't be written to, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsWriteHeapSnapshot(
+    _In_ JsRuntimeHandle runtime,
+    _In_ int fd);
+
+/// <summary>
+///     Starts sampling the allocations of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     About once every <c>sampleInterval</c> bytes allocated, the JavaScript stack of the
+///     allocation is recorded along with the bytes allocated since the previous sample. The samples
+///     are aggregated by stack, so the profile's size doesn't grow with the length of the run and
+///     sampling can be left on. The sample points are randomized around the interval.
+///     </para>
+///     <para>
+///     Starting again discards the previous profile.
+///     </para>
+///     <para>
+///     Requires the runtime to not be in use on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to sample the allocations of.</param>
+/// <param name="sampleInterval">
+///     The average number of bytes between samples, or 0 for the default of 512KB.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsStartAllocationSampling(
+    _In_ JsRuntimeHandle runtime,
+    _In_ unsigned int sampleInterval);
+
+/// <summary>
+///     Stops sampling the allocations of a runtime.
+/// </summary>
+/// <remarks>
+///     The profile is kept until sampling is started again or the runtime is disposed, so it can
+///     still be written out with <c>JsWriteAllocationSamplingProfile</c>.
+/// </remarks>
+/// <param name="runtime">The runtime to stop sampling the allocations of.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsStopAllocationSampling(
+    _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Writes the allocation sampling profile of a runtime to a file descriptor.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The profile is written in the .heapprofile JSON format that the browser developer tools
+///     load: a tree of the sampled call stacks where the self size of each function is the estimated
+///     number of bytes it allocated. Line and column numbers are 0-based.
+///     </para>
+///     <para>
+///     Only the innermost 64 frames of a stack are kept. The frames of a deeper stack are put
+///     under a <c>(truncated)</c> node instead of directly under the root.
+///     </para>
+///     <para>
+///     Allocations done inline by jitted code aren't sampled, they only show up through the
+///     allocations that follow them.
+///     </para>
+///     <para>
+///     The file descriptor is written to from the calling thread and is left open.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to write the allocation sampling profile of.</param>
+/// <param name="fd">The file descriptor to write the profile to.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     sampling was never started or the file descriptor couldn't be written to, a failure code
+///     otherwise.
+/// </returns>
+CHAKRA_API
+JsWriteAllocationSamplingProfile(
+    _In_ JsRuntimeHandle runtime,
+    _In_ int fd);
+
+/// <summary>
+///     Loads a JIT warm-up cache written by an earlier run into a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The cache records which functions were full JIT'ed, keyed by a hash of their byte code.
+///     Functions of the cache skip the simple JIT and are full JIT'ed after a few profiled calls
+///     instead of a few hundred. Machine code isn't cached: the full JIT compiles the functions
+///     again from the types seen in this run, so the code doesn't depend on anything the earlier
+///     run assumed.
+///     </para>
+///     <para>
+///     Once a cache is loaded, the runtime records the functions it full JITs, and
+///     <c>JsWriteJitWarmupCache</c> writes them out for the next run. An empty file starts
+///     an empty cache, as does the first write when no cache was loaded. Load the cache before running scripts: functions that already have byte
+///     code aren't looked up.
+///     </para>
+///     <para>
+///     The file descriptor is read from the calling thread and is left open.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to load the cache into.</param>
+/// <param name="fd">The file descriptor to read the cache from.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the file isn't a cache written by this version of ChakraCore or is damaged, a failure code
+///     otherwise.
+/// </returns>
+CHAKRA_API
+JsLoadJitWarmupCache(
+    _In_ JsRuntimeHandle runtime,
+    _In_ int fd);
+
+/// <summary>
+///     Writes the JIT warm-up cache of a runtime to a file descriptor.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The cache holds the functions full JIT'ed by this run, along with the functions loaded
+///     from the earlier cache that were full JIT'ed by one of the last few runs.
+///     </para>
+///     <para>
+///     The file descriptor is written to from the calling thread and is left open.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to write the cache of.</param>
+/// <param name="fd">The file descriptor to write the cache to.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the file descriptor couldn't be written to, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsWriteJitWarmupCache(
+    _In_ JsRuntimeHandle runtime,
+    _In_ int fd);
+
+/// <summary>
+///     Loads a dynamic profile cache written by an earlier run into a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The cache holds the dynamic profiles of the functions that ran: the types seen by their
+///     parameters, fields, elements, calls and returns, the optimizations the JIT had to back off
+///     from, the number of calls they were profiled over and the number of times their loops ran.
+///     Profiles are keyed by a hash of the source of the functions. A function whose profile is
+///     found starts with it instead of an empty one. If it was profiled long enough, the function
+///     skips the simple JIT and is full JIT'ed after a few calls, and its loops that were hot
+///     start profiling for loop body JIT right away.
+///     </para>
+///     <para>
+///     Once a cache is loaded, the runtime saves the profiles of a script context when it is
+///     closed, and <c>JsWriteDynamicProfileCache</c> writes them out for the next run. An empty
+///     file starts an empty cache. Load the cache before running scripts: functions that already
+///     have byte code aren't looked up.
+///     </para>
+///     <para>
+///     The file descriptor is read from the calling thread and is left open.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to load the cache into.</param>
+/// <param name="fd">The file descriptor to read the cache from.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the file isn't a cache written by this version of ChakraCore or is damaged,
+///     <c>JsErrorNotImplemented</c> if this build doesn't profile, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsLoadDynamicProfileCache(
+    _In_ JsRuntimeHandle runtime,
+    _In_ int fd);
+
+/// <summary>
+///     Writes the dynamic profile cache of a runtime to a file descriptor.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The profiles of the script contexts of the runtime are saved first. The cache also holds
+///     the profiles of the script contexts closed so far, and the profiles loaded from the earlier
+///     cache that were saved by one of the last few runs.
+///     </para>
+///     <para>
+///     The file descriptor is written to from the calling thread and is left open.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to write the cache of.</param>
+/// <param name="fd">The file descriptor to write the cache to.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     no cache was loaded or the file descriptor couldn't be written to,
+///     <c>JsErrorNotImplemented</c> if this build doesn't profile, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsWriteDynamicProfileCache(
+    _In_ JsRuntimeHandle runtime,
+    _In_ int fd);
+
 #endif // _CHAKRACOREBUILD
 #endif // _CHAKRACORE_H_
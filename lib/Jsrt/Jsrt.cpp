@@ -26,6 +26,11 @@
 #include "TestHooksRt.h"
 #endif
 
+#include "Memory/RecyclerHeapSnapshotWriter.h"
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 struct CodexHeapAllocatorInterface
 {
 public:
@@ -271,7 +276,9 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             JsRuntimeAttributeDisableEval |
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeEnableExperimentalFeatures |
-            JsRuntimeAttributeDispatchSetExceptionsToDebugger
+            JsRuntimeAttributeDispatchSetExceptionsToDebugger |
+            JsRuntimeAttributeEnableHugePages |
+            JsRuntimeAttributeEnableBackgroundFinalize
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -323,6 +330,16 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             threadContext->SetThreadContextFlag(ThreadContextFlagNoJIT);
         }
 
+        if (attributes & JsRuntimeAttributeEnableHugePages)
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagHugePages);
+        }
+
+        if (attributes & JsRuntimeAttributeEnableBackgroundFinalize)
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagBackgroundFinalize);
+        }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.PrimeRecycler)
         {
@@ -2764,6 +2781,444 @@ CHAKRA_API JsGetRuntimeMemoryLimit(_In_ JsRuntimeHandle runtimeHandle, _Out_ siz
     return JsNoError;
 }
 
+#ifdef _CHAKRACOREBUILD
+CHAKRA_API JsSetRuntimeGCPauseBudget(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int pauseBudget)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->EnsureRecycler()->SetPauseBudget(pauseBudget);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeGCPauseHistogram(_In_ JsRuntimeHandle runtimeHandle, _Out_writes_opt_(bucketCount) unsigned int *pauseCounts,
+    _In_ unsigned int bucketCount, _Out_opt_ unsigned int *actualBucketCount)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (pauseCounts == nullptr && bucketCount != 0)
+        {
+            return JsErrorNullArgument;
+        }
+
+        if (actualBucketCount != nullptr)
+        {
+            *actualBucketCount = RecyclerPauseHistogram::BucketCount;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        RecyclerPauseHistogram const& pauseHistogram = threadContext->EnsureRecycler()->GetPauseHistogram();
+        for (unsigned int i = 0; i < bucketCount; i++)
+        {
+            pauseCounts[i] = i < RecyclerPauseHistogram::BucketCount ? pauseHistogram.GetCount(i) : 0;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsEnableRuntimeAllocationHistogram(_In_ JsRuntimeHandle runtimeHandle)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (!threadContext->EnsureRecycler()->EnableSizeHistogram())
+        {
+            return JsErrorOutOfMemory;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeAllocationHistogram(_In_ JsRuntimeHandle runtimeHandle, _Out_writes_opt_(entryCount) JsAllocationHistogramEntry *entries,
+    _In_ unsigned int entryCount, _Out_opt_ unsigned int *actualEntryCount)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (entries == nullptr && entryCount != 0)
+        {
+            return JsErrorNullArgument;
+        }
+
+        if (actualEntryCount != nullptr)
+        {
+            *actualEntryCount = RecyclerSizeHistogram::EntryCount;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        RecyclerSizeHistogram const * sizeHistogram = threadContext->EnsureRecycler()->GetSizeHistogram();
+        if (sizeHistogram == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        for (unsigned int i = 0; i < entryCount; i++)
+        {
+            if (i < RecyclerSizeHistogram::EntryCount)
+            {
+                RecyclerSizeHistogram::Entry const& entry = sizeHistogram->GetEntry(i);
+                entries[i].bucketSize = RecyclerSizeHistogram::GetBucketSize(i);
+                entries[i].allocationCount = entry.allocationCount;
+                entries[i].requestedBytes = entry.requestedBytes;
+                entries[i].allocatedBytes = entry.allocatedBytes;
+            }
+            else
+            {
+                memset(&entries[i], 0, sizeof(JsAllocationHistogramEntry));
+            }
+        }
+        return JsNoError;
+    });
+}
+
+static bool CALLBACK WriteToFileDescriptor(char const * buffer, size_t length, void * context)
+{
+    int fd = (int)(intptr_t)context;
+    while (length != 0)
+    {
+#ifdef _WIN32
+        int written = _write(fd, buffer, (unsigned int)min(length, (size_t)INT_MAX));
+#else
+        ssize_t written = write(fd, buffer, length);
+#endif
+        if (written <= 0)
+        {
+            return false;
+        }
+        buffer += written;
+        length -= written;
+    }
+    return true;
+}
+
+CHAKRA_API JsWriteHeapSnapshot(_In_ JsRuntimeHandle runtimeHandle, _In_ int fd)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (fd < 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        // Collect first so the snapshot only has the objects that are still alive
+        Recycler * recycler = threadContext->EnsureRecycler();
+        recycler->CollectNow<CollectNowExhaustive>();
+
+        RecyclerHeapSnapshotWriter writer(recycler, WriteToFileDescriptor, (void *)(intptr_t)fd);
+        if (!writer.Write())
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStartAllocationSampling(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int sampleInterval)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (!threadContext->StartAllocationSampling(sampleInterval != 0 ? sampleInterval : AllocationSampleProfile::DefaultSampleInterval))
+        {
+            return JsErrorOutOfMemory;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStopAllocationSampling(_In_ JsRuntimeHandle runtimeHandle)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->StopAllocationSampling();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsWriteAllocationSamplingProfile(_In_ JsRuntimeHandle runtimeHandle, _In_ int fd)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (fd < 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        AllocationSampleProfile * profile = threadContext->GetAllocationSampleProfile();
+        if (profile == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // The write doesn't allocate from the recycler, so it's fine with sampling still running
+        if (!profile->Write(WriteToFileDescriptor, (void *)(intptr_t)fd))
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+}
+
+static int CALLBACK ReadFromFileDescriptor(char * buffer, size_t length, void * context)
+{
+    int fd = (int)(intptr_t)context;
+#ifdef _WIN32
+    return _read(fd, buffer, (unsigned int)min(length, (size_t)INT_MAX));
+#else
+    return (int)read(fd, buffer, min(length, (size_t)INT_MAX));
+#endif
+}
+
+CHAKRA_API JsLoadJitWarmupCache(_In_ JsRuntimeHandle runtimeHandle, _In_ int fd)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (fd < 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (!threadContext->LoadJitWarmupCache(ReadFromFileDescriptor, (void *)(intptr_t)fd))
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsWriteJitWarmupCache(_In_ JsRuntimeHandle runtimeHandle, _In_ int fd)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (fd < 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        // The first write starts a cache, which records the functions full JIT'ed from then on
+        JitWarmupCache * jitWarmupCache = threadContext->EnsureJitWarmupCache();
+        if (jitWarmupCache == nullptr)
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        if (!jitWarmupCache->Write(WriteToFileDescriptor, (void *)(intptr_t)fd))
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsLoadDynamicProfileCache(_In_ JsRuntimeHandle runtimeHandle, _In_ int fd)
+{
+#if ENABLE_PROFILE_INFO
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (fd < 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (!threadContext->LoadDynamicProfileCache(ReadFromFileDescriptor, (void *)(intptr_t)fd))
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API JsWriteDynamicProfileCache(_In_ JsRuntimeHandle runtimeHandle, _In_ int fd)
+{
+#if ENABLE_PROFILE_INFO
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (fd < 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Js::DynamicProfileCache * dynamicProfileCache = threadContext->GetDynamicProfileCache();
+        if (dynamicProfileCache == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // Closed script contexts saved their profiles when they were closed
+        for (Js::ScriptContext * scriptContext = threadContext->GetScriptContextList(); scriptContext != nullptr; scriptContext = scriptContext->next)
+        {
+            if (!scriptContext->IsClosed())
+            {
+                dynamicProfileCache->SaveScriptContext(scriptContext);
+            }
+        }
+
+        if (!dynamicProfileCache->Write(WriteToFileDescriptor, (void *)(intptr_t)fd))
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+#endif // _CHAKRACOREBUILD
+
 C_ASSERT(JsMemoryAllocate == (_JsMemoryEventType) AllocationPolicyManager::MemoryAllocateEvent::MemoryAllocate);
 C_ASSERT(JsMemoryFree == (_JsMemoryEventType) AllocationPolicyManager::MemoryAllocateEvent::MemoryFree);
 C_ASSERT(JsMemoryFailure == (_JsMemoryEventType) AllocationPolicyManager::MemoryAllocateEvent::MemoryFailure);
@@ -22,6 +22,12 @@ namespace Js
     {
         if (finalizeCallback != nullptr)
         {
+            // See JsrtExternalObject::Finalize
+            if (!isShutdown && this->GetRecycler()->QueueBackgroundFinalize(finalizeCallback, callbackState))
+            {
+                return;
+            }
+
             finalizeCallback(callbackState);
         }
     }
@@ -72,6 +72,12 @@ void JsrtExternalObject::Finalize(bool isShutdown)
     JsFinalizeCallback finalizeCallback = this->GetExternalType()->GetJsFinalizeCallback();
     if (nullptr != finalizeCallback)
     {
+        // The host declared its finalize callbacks thread-agnostic if the runtime has background finalize on
+        if (!isShutdown && this->GetRecycler()->QueueBackgroundFinalize(finalizeCallback, this->slot))
+        {
+            return;
+        }
+
         JsrtCallbackState scope(nullptr);
         finalizeCallback(this->slot);
     }
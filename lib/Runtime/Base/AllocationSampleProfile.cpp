@@ -0,0 +1,204 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+
+AllocationSampleProfile::AllocationSampleProfile() :
+    nodes(nullptr),
+    nodeCount(0),
+    nodeCapacity(0),
+    sampleCount(0)
+{
+}
+
+AllocationSampleProfile::~AllocationSampleProfile()
+{
+    for (uint i = 0; i < nodeCount; i++)
+    {
+        if (nodes[i].functionName != nullptr)
+        {
+            HeapDeleteArray(wcslen(nodes[i].functionName) + 1, nodes[i].functionName);
+        }
+        if (nodes[i].url != nullptr)
+        {
+            HeapDeleteArray(wcslen(nodes[i].url) + 1, nodes[i].url);
+        }
+    }
+
+    if (nodes != nullptr)
+    {
+        HeapDeleteArray(nodeCapacity, nodes);
+    }
+}
+
+bool
+AllocationSampleProfile::AddSample(Frame const * frames, uint frameCount, bool truncated, size_t sampledBytes)
+{
+    if (nodeCount == 0 && AddNode(nullptr) == InvalidNodeIndex)
+    {
+        return false;
+    }
+
+    uint index = RootNodeIndex;
+    if (truncated)
+    {
+        index = GetChild(index, nullptr);
+        if (index == InvalidNodeIndex)
+        {
+            return false;
+        }
+    }
+
+    for (uint i = 0; i < frameCount; i++)
+    {
+        index = GetChild(index, &frames[i]);
+        if (index == InvalidNodeIndex)
+        {
+            return false;
+        }
+    }
+
+    nodes[index].selfBytes += sampledBytes;
+    sampleCount++;
+    return true;
+}
+
+uint
+AllocationSampleProfile::GetChild(uint parent, Frame const * frame)
+{
+    for (uint child = nodes[parent].firstChild; child != InvalidNodeIndex; child = nodes[child].nextSibling)
+    {
+        if (frame == nullptr ?
+            nodes[child].isTruncated :
+            !nodes[child].isTruncated && nodes[child].sourceInfoId == frame->sourceInfoId && nodes[child].functionId == frame->functionId)
+        {
+            return child;
+        }
+    }
+
+    uint child = AddNode(frame);
+    if (child != InvalidNodeIndex)
+    {
+        nodes[child].isTruncated = (frame == nullptr);
+        nodes[child].nextSibling = nodes[parent].firstChild;
+        nodes[parent].firstChild = child;
+    }
+    return child;
+}
+
+uint
+AllocationSampleProfile::AddNode(Frame const * frame)
+{
+    if (nodeCount == nodeCapacity)
+    {
+        uint newCapacity = max(nodeCapacity * 2, 64u);
+        Node * newNodes = HeapNewNoThrowArray(Node, newCapacity);
+        if (newNodes == nullptr)
+        {
+            return InvalidNodeIndex;
+        }
+
+        if (nodes != nullptr)
+        {
+            js_memcpy_s(newNodes, newCapacity * sizeof(Node), nodes, nodeCount * sizeof(Node));
+            HeapDeleteArray(nodeCapacity, nodes);
+        }
+        nodes = newNodes;
+        nodeCapacity = newCapacity;
+    }
+
+    Node& node = nodes[nodeCount];
+    node.firstChild = InvalidNodeIndex;
+    node.nextSibling = InvalidNodeIndex;
+    node.selfBytes = 0;
+    node.isTruncated = false;
+
+    if (frame == nullptr)
+    {
+        node.sourceInfoId = 0;
+        node.functionId = 0;
+        node.functionName = nullptr;
+        node.url = nullptr;
+        node.lineNumber = 0;
+        node.columnNumber = 0;
+    }
+    else
+    {
+        Js::FunctionBody * functionBody = frame->functionBody;
+        node.sourceInfoId = frame->sourceInfoId;
+        node.functionId = frame->functionId;
+        node.functionName = CopyString(functionBody->GetExternalDisplayName());
+        node.url = CopyString(functionBody->GetSourceName());
+        node.lineNumber = functionBody->GetLineNumber();
+        node.columnNumber = functionBody->GetColumnNumber();
+    }
+
+    return nodeCount++;
+}
+
+char16 *
+AllocationSampleProfile::CopyString(char16 const * string)
+{
+    // A name we can't copy is written out empty rather than failing the sample
+    if (string == nullptr)
+    {
+        return nullptr;
+    }
+
+    size_t length = wcslen(string) + 1;
+    char16 * copy = HeapNewNoThrowArray(char16, length);
+    if (copy != nullptr)
+    {
+        js_memcpy_s(copy, length * sizeof(char16), string, length * sizeof(char16));
+    }
+    return copy;
+}
+
+bool
+AllocationSampleProfile::Write(JsonStreamWriteCallback writeCallback, void * writeContext)
+{
+    if (nodeCount == 0 && AddNode(nullptr) == InvalidNodeIndex)
+    {
+        return false;
+    }
+
+    JsonStreamWriter writer(writeCallback, writeContext);
+    writer.WriteRaw("{\"head\":");
+    WriteNode(writer, RootNodeIndex);
+    writer.WriteRaw(",\"samples\":[]}");
+    return writer.Flush();
+}
+
+void
+AllocationSampleProfile::WriteNode(JsonStreamWriter& writer, uint index)
+{
+    Node const& node = nodes[index];
+
+    writer.WriteRaw("{\"callFrame\":{\"functionName\":");
+    writer.WriteString(index == RootNodeIndex ? _u("(root)") : node.isTruncated ? _u("(truncated)") : node.functionName);
+    writer.WriteRaw(",\"scriptId\":\"");
+    writer.WriteNumber(node.sourceInfoId);
+    writer.WriteRaw("\",\"url\":");
+    writer.WriteString(node.url);
+    writer.WriteRaw(",\"lineNumber\":");
+    writer.WriteNumber(node.lineNumber);
+    writer.WriteRaw(",\"columnNumber\":");
+    writer.WriteNumber(node.columnNumber);
+    writer.WriteRaw("},\"selfSize\":");
+    writer.WriteNumber(node.selfBytes);
+    writer.WriteRaw(",\"id\":");
+    writer.WriteNumber(index + 1);
+    writer.WriteRaw(",\"children\":[");
+
+    // The tree is at most MaxStackDepth deep below the (truncated) node, so the recursion is bounded
+    for (uint child = node.firstChild; child != InvalidNodeIndex; child = nodes[child].nextSibling)
+    {
+        if (child != node.firstChild)
+        {
+            writer.WriteChar(',');
+        }
+        WriteNode(writer, child);
+    }
+    writer.WriteRaw("]}");
+}
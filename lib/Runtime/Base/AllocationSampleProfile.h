@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+/*
+ * AllocationSampleProfile aggregates the recycler's allocation samples into a tree of the JavaScript
+ * stacks they were taken on. Each sample carries the bytes allocated since the sample before it, so
+ * the bytes of a node estimate what its function allocated with the stack above it.
+ *
+ * Samples are added from inside the recycler's allocation path: nothing here allocates from the
+ * recycler, and running out of memory drops the sample instead of throwing. Functions are keyed by
+ * their source info id and local function id rather than by their FunctionBody, which the profile
+ * doesn't keep alive, and their names are copied when their node is created. Only the innermost
+ * MaxStackDepth frames of a stack are kept: the frames of a deeper stack hang off a (truncated) node
+ * under the root, so that they aren't mistaken for the outermost frames.
+ *
+ * The tree is written out in the .heapprofile JSON format that the browser developer tools load.
+ */
+class AllocationSampleProfile
+{
+public:
+    static const size_t DefaultSampleInterval = 512 * 1024;
+    static const uint MaxStackDepth = 64;
+
+    struct Frame
+    {
+        Js::FunctionBody * functionBody;
+        uint sourceInfoId;
+        Js::LocalFunctionId functionId;
+    };
+
+    AllocationSampleProfile();
+    ~AllocationSampleProfile();
+
+    // Frames go from the outermost to the innermost, truncated is set if frames above them were dropped.
+    // Returns false if we ran out of memory.
+    bool AddSample(Frame const * frames, uint frameCount, bool truncated, size_t sampledBytes);
+    uint64 GetSampleCount() const { return this->sampleCount; }
+
+    // Returns false if the write callback failed
+    bool Write(JsonStreamWriteCallback writeCallback, void * writeContext);
+
+private:
+    static const uint RootNodeIndex = 0;
+    static const uint InvalidNodeIndex = UINT_MAX;
+
+    struct Node
+    {
+        uint sourceInfoId;
+        Js::LocalFunctionId functionId;
+        uint firstChild;
+        uint nextSibling;
+        char16 * functionName;
+        char16 * url;
+        ULONG lineNumber;
+        ULONG columnNumber;
+        uint64 selfBytes;
+        bool isTruncated;
+    };
+
+    // A null frame is the (truncated) node
+    uint GetChild(uint parent, Frame const * frame);
+    uint AddNode(Frame const * frame);
+    static char16 * CopyString(char16 const * string);
+
+    void WriteNode(JsonStreamWriter& writer, uint index);
+
+    Node * nodes;
+    uint nodeCount;
+    uint nodeCapacity;
+    uint64 sampleCount;
+};
@@ -0,0 +1,160 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+#include "ByteCode/ByteCodeCacheReleaseFileVersion.h"
+
+CacheFile::RecordWriter::RecordWriter(CacheFileWriteCallback writeCallback, void * writeContext) :
+    writeCallback(writeCallback),
+    writeContext(writeContext),
+    dataLength(0),
+    checksum(ChecksumSeed)
+{
+}
+
+bool
+CacheFile::RecordWriter::Write(void const * buffer, size_t length)
+{
+    if (writeCallback == nullptr)
+    {
+        dataLength += length;
+        checksum = UpdateChecksum(checksum, buffer, length);
+        return true;
+    }
+    return length == 0 || writeCallback(static_cast<char const *>(buffer), length, writeContext);
+}
+
+CacheFile::CacheFile(uint32 magic, uint32 formatVersion) :
+    magic(magic),
+    formatVersion(formatVersion),
+    data(nullptr),
+    dataLength(0),
+    recordCount(0)
+{
+}
+
+CacheFile::~CacheFile()
+{
+    if (data != nullptr)
+    {
+        HeapDeleteArray(max(dataLength, 1u), data);
+    }
+}
+
+bool
+CacheFile::AgeRecord(uint32 * staleRuns)
+{
+    if (*staleRuns >= MaxStaleRuns)
+    {
+        return false;
+    }
+    (*staleRuns)++;
+    return true;
+}
+
+uint64
+CacheFile::GetKey(const byte * buffer, size_t length)
+{
+    uint64 hash = 14695981039346656037ull ^ length;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= buffer[i];
+        hash *= 1099511628211ull;
+    }
+    return hash == 0 ? 1 : hash;
+}
+
+uint32
+CacheFile::UpdateChecksum(uint32 checksum, const void * buffer, size_t length)
+{
+    // FNV-1a, 32-bit
+    const byte * bytes = static_cast<const byte *>(buffer);
+    for (size_t i = 0; i < length; i++)
+    {
+        checksum ^= bytes[i];
+        checksum *= 16777619u;
+    }
+    return checksum;
+}
+
+bool
+CacheFile::Read(CacheFileReadCallback readCallback, void * readContext)
+{
+    Assert(data == nullptr);
+
+    // A read error fails the whole read, unlike the end of the input
+    bool readFailed = false;
+    const auto ReadAll = [&](char * buffer, size_t length) -> size_t
+    {
+        size_t readLength = 0;
+        while (readLength < length)
+        {
+            int result = readCallback(buffer + readLength, length - readLength, readContext);
+            if (result <= 0)
+            {
+                readFailed = (result < 0);
+                break;
+            }
+            readLength += result;
+        }
+        return readLength;
+    };
+
+    Header header;
+    size_t headerLength = ReadAll(reinterpret_cast<char *>(&header), sizeof(header));
+    if (readFailed)
+    {
+        return false;
+    }
+    if (headerLength == 0)
+    {
+        return true;
+    }
+
+    if (headerLength != sizeof(header) ||
+        header.magic != magic ||
+        header.formatVersion != formatVersion ||
+        header.engineVersion != byteCodeCacheReleaseFileVersion ||
+        header.dataLength > INT_MAX)
+    {
+        return false;
+    }
+
+    char * fileData = HeapNewNoThrowArray(char, max(header.dataLength, 1u));
+    if (fileData == nullptr)
+    {
+        return false;
+    }
+
+    if (ReadAll(fileData, header.dataLength) != header.dataLength ||
+        readFailed ||
+        UpdateChecksum(ChecksumSeed, fileData, header.dataLength) != header.checksum)
+    {
+        HeapDeleteArray(max(header.dataLength, 1u), fileData);
+        return false;
+    }
+
+    data = fileData;
+    dataLength = header.dataLength;
+    recordCount = header.recordCount;
+    return true;
+}
+
+bool
+CacheFile::WriteHeader(uint32 recordCount, RecordWriter const& checksumWriter, CacheFileWriteCallback writeCallback, void * writeContext) const
+{
+    if (checksumWriter.dataLength > INT_MAX)
+    {
+        return false;
+    }
+
+    Header header;
+    header.magic = magic;
+    header.formatVersion = formatVersion;
+    header.engineVersion = byteCodeCacheReleaseFileVersion;
+    header.recordCount = recordCount;
+    header.dataLength = static_cast<uint32>(checksumWriter.dataLength);
+    header.checksum = checksumWriter.checksum;
+    return writeCallback(reinterpret_cast<char const *>(&header), sizeof(header), writeContext);
+}
@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Returns the number of bytes read, 0 at the end of the input, or -1 if the input couldn't be read
+typedef int (CALLBACK * CacheFileReadCallback)(char * buffer, size_t length, void * context);
+// Returns false if the output couldn't be written
+typedef bool (CALLBACK * CacheFileWriteCallback)(char const * buffer, size_t length, void * context);
+
+/*
+ * CacheFile reads and writes the files that carry the engine's caches across runs of a process.
+ *
+ * A file is a header followed by the records of the cache. The header holds the magic number and format
+ * version of the cache, the release file version of the engine, so that a file is only ever read back by
+ * the build that wrote it, and an FNV-1a checksum of the records. The whole file is read and validated
+ * before any of it is handed to the cache, so a damaged file leaves the cache as it was.
+ *
+ * Records carry the number of runs since they were last used: a record read back counts the run as stale
+ * until the cache uses it again, and records stale for MaxStaleRuns runs are dropped.
+ */
+class CacheFile
+{
+public:
+    static const uint MaxStaleRuns = 8;
+
+    // Passed to the function that produces the records of a cache being written, which is called twice:
+    // once to checksum the records, then to write them out
+    class RecordWriter
+    {
+    public:
+        // Returns false if the write callback failed, which stops the write
+        bool Write(void const * buffer, size_t length);
+
+    private:
+        friend class CacheFile;
+        RecordWriter(CacheFileWriteCallback writeCallback, void * writeContext);
+
+        CacheFileWriteCallback writeCallback;
+        void * writeContext;
+        size_t dataLength;
+        uint32 checksum;
+    };
+
+    CacheFile(uint32 magic, uint32 formatVersion);
+    ~CacheFile();
+
+    // Returns false if the input couldn't be read, isn't a cache of this kind written by this version
+    // of the engine, or is damaged. An empty input is a valid cache with no records.
+    bool Read(CacheFileReadCallback readCallback, void * readContext);
+    char const * GetData() const { return data; }
+    uint32 GetDataLength() const { return dataLength; }
+    uint32 GetRecordCount() const { return recordCount; }
+
+    // Returns false if the write callback failed
+    template <typename Fn>
+    bool Write(uint32 recordCount, CacheFileWriteCallback writeCallback, void * writeContext, Fn writeRecords) const
+    {
+        RecordWriter checksumWriter(nullptr, nullptr);
+        writeRecords(checksumWriter);
+
+        RecordWriter recordWriter(writeCallback, writeContext);
+        return WriteHeader(recordCount, checksumWriter, writeCallback, writeContext) && writeRecords(recordWriter);
+    }
+
+    // Ages a record read back from a file. Returns false if it has been stale for too many runs to keep.
+    static bool AgeRecord(uint32 * staleRuns);
+    // FNV-1a over the buffer, seeded with its length. Never 0, which the caches can use as an empty key.
+    static uint64 GetKey(const byte * buffer, size_t length);
+
+private:
+    static const uint32 ChecksumSeed = 2166136261u;
+
+    struct Header
+    {
+        uint32 magic;
+        uint32 formatVersion;
+        GUID engineVersion;
+        uint32 recordCount;
+        uint32 dataLength;
+        uint32 checksum;
+    };
+
+    static uint32 UpdateChecksum(uint32 checksum, const void * buffer, size_t length);
+    bool WriteHeader(uint32 recordCount, RecordWriter const& checksumWriter, CacheFileWriteCallback writeCallback, void * writeContext) const;
+
+    uint32 magic;
+    uint32 formatVersion;
+    char * data;
+    uint32 dataLength;
+    uint32 recordCount;
+};
@@ -3363,17 +3363,29 @@ namespace Js
         if (sourceDynamicProfileManager != nullptr)
         {
             this->dynamicProfileInfo = sourceDynamicProfileManager->GetDynamicProfileInfo(this);
+        }
+
+        if (this->dynamicProfileInfo == nullptr)
+        {
+            // The cache isn't synchronized, so byte code generated by a background parser isn't looked up
+            ThreadContext *const threadContext = GetScriptContext()->GetThreadContext();
+            DynamicProfileCache *const dynamicProfileCache = threadContext->GetDynamicProfileCache();
+            if (dynamicProfileCache != nullptr && ThreadContext::GetContextForCurrentThread() == threadContext)
+            {
+                this->dynamicProfileInfo = dynamicProfileCache->LoadDynamicProfileInfo(this);
+            }
+        }
+
 #if DBG_DUMP
-            if(this->dynamicProfileInfo)
+        if(this->dynamicProfileInfo)
+        {
+            if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, this->GetSourceContextId(), this->GetLocalFunctionId()))
             {
-                if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, this->GetSourceContextId(), this->GetLocalFunctionId()))
-                {
-                    Output::Print(_u("Loaded:"));
-                    this->dynamicProfileInfo->Dump(this);
-                }
+                Output::Print(_u("Loaded:"));
+                this->dynamicProfileInfo->Dump(this);
             }
-#endif
         }
+#endif
 
 #ifdef DYNAMIC_PROFILE_MUTATOR
         DynamicProfileMutator::Mutate(this);
@@ -3839,6 +3851,10 @@ namespace Js
         this->byteCodeBlock = byteCodeBlock;
         PERF_COUNTER_ADD(Code, TotalByteCodeSize, byteCodeSize);
 
+#if ENABLE_NATIVE_CODEGEN
+        CheckJitWarmupCache();
+#endif
+
         // If this is a defer parse function body, we would not have registered it
         // on the function bodies list so we should register it now
         if (!this->m_isFuncRegistered)
@@ -6659,6 +6675,32 @@ namespace Js
         executionState.SetIsSpeculativeJitCandidate();
     }
 
+    void FunctionBody::SetIsJitWarmupCandidate(const uint16 warmupFullJitThreshold)
+    {
+        executionState.SetIsJitWarmupCandidate(warmupFullJitThreshold);
+    }
+
+#if ENABLE_NATIVE_CODEGEN
+    void FunctionBody::CheckJitWarmupCache()
+    {
+        ThreadContext *const threadContext = GetScriptContext()->GetThreadContext();
+        JitWarmupCache *const jitWarmupCache = threadContext->GetJitWarmupCache();
+
+        // The cache isn't synchronized, so byte code generated by a background parser isn't looked up
+        if (jitWarmupCache == nullptr ||
+            this->byteCodeBlock == nullptr ||
+            ThreadContext::GetContextForCurrentThread() != threadContext)
+        {
+            return;
+        }
+
+        if (jitWarmupCache->Contains(this->byteCodeBlock))
+        {
+            SetIsJitWarmupCandidate(static_cast<uint16>(CONFIG_FLAG(JitWarmupFullJitThreshold)));
+        }
+    }
+#endif
+
     bool FunctionBody::TryTransitionToJitExecutionMode()
     {
         return executionState.TryTransitionToJitExecutionMode();
@@ -2610,6 +2610,10 @@ namespace Js
         bool TryTransitionToNextExecutionMode();
         void TryTransitionToNextInterpreterExecutionMode();
         void SetIsSpeculativeJitCandidate();
+        void SetIsJitWarmupCandidate(const uint16 warmupFullJitThreshold);
+#if ENABLE_NATIVE_CODEGEN
+        void CheckJitWarmupCache();
+#endif
         bool TryTransitionToJitExecutionMode();
         void TransitionToSimpleJitExecutionMode();
         void TransitionToFullJitExecutionMode();
@@ -658,6 +658,24 @@ namespace Js
         TryTransitionToNextInterpreterExecutionMode();
     }
 
+    void FunctionExecutionStateMachine::SetIsJitWarmupCandidate(const uint16 warmupFullJitThreshold)
+    {
+        // This function was full JIT'ed, or profiled enough to be, in an earlier run of the process. Skip simple JIT and full
+        // JIT it as soon as it has been profiled enough for the full JIT to make its speculative decisions based on this run.
+        if (GetExecutionMode() == ExecutionMode::FullJit || fullJitThreshold <= warmupFullJitThreshold)
+        {
+            return;
+        }
+
+        owner->TraceExecutionMode("IsJitWarmupCandidate (before)");
+
+        SetFullJitThreshold(warmupFullJitThreshold, true /* skipSimpleJit */);
+
+        owner->TraceExecutionMode("IsJitWarmupCandidate");
+
+        TryTransitionToNextInterpreterExecutionMode();
+    }
+
     void FunctionExecutionStateMachine::ResetSimpleJitLimit()
     {
         Assert(initializedExecutionModeAndLimits);
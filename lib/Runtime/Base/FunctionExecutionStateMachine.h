@@ -31,6 +31,7 @@ namespace Js
 
         // JIT-relatedfunctions
         void SetIsSpeculativeJitCandidate();
+        void SetIsJitWarmupCandidate(const uint16 warmupFullJitThreshold);
         uint16 GetSimpleJitLimit() const { return simpleJitLimit; }
         void ResetSimpleJitLimit();
         uint16 GetSimpleJitExecutedIterations() const;
@@ -0,0 +1,180 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+
+JitWarmupCache::JitWarmupCache() :
+    entries(nullptr),
+    entryCount(0),
+    capacity(0)
+{
+}
+
+JitWarmupCache::~JitWarmupCache()
+{
+    if (entries != nullptr)
+    {
+        HeapDeleteArray(capacity, entries);
+    }
+}
+
+uint64
+JitWarmupCache::GetKey(Js::ByteBlock * byteCodeBlock)
+{
+    return CacheFile::GetKey(byteCodeBlock->GetBuffer(), byteCodeBlock->GetLength());
+}
+
+bool
+JitWarmupCache::Contains(Js::ByteBlock * byteCodeBlock) const
+{
+    return entryCount != 0 && Find(GetKey(byteCodeBlock)) != nullptr;
+}
+
+void
+JitWarmupCache::AddFullJitFunction(Js::ByteBlock * byteCodeBlock)
+{
+    uint64 key = GetKey(byteCodeBlock);
+    Entry * entry = Find(key);
+    if (entry != nullptr)
+    {
+        entry->staleRuns = 0;
+        return;
+    }
+    Add(key, 0);
+}
+
+JitWarmupCache::Entry *
+JitWarmupCache::Find(uint64 key) const
+{
+    if (capacity == 0)
+    {
+        return nullptr;
+    }
+
+    // Open addressing with linear probing, the table is never more than half full
+    for (uint i = (uint)key & (capacity - 1); ; i = (i + 1) & (capacity - 1))
+    {
+        if (entries[i].key == key)
+        {
+            return &entries[i];
+        }
+        if (entries[i].key == EmptyKey)
+        {
+            return nullptr;
+        }
+    }
+}
+
+bool
+JitWarmupCache::Add(uint64 key, uint32 staleRuns)
+{
+    Assert(key != EmptyKey);
+    Assert(Find(key) == nullptr);
+
+    if ((entryCount + 1) * 2 > capacity && !Grow())
+    {
+        return false;
+    }
+
+    uint i = (uint)key & (capacity - 1);
+    while (entries[i].key != EmptyKey)
+    {
+        i = (i + 1) & (capacity - 1);
+    }
+    entries[i].key = key;
+    entries[i].staleRuns = staleRuns;
+    entries[i].reserved = 0;
+    entryCount++;
+    return true;
+}
+
+bool
+JitWarmupCache::Grow()
+{
+    uint newCapacity = max(capacity * 2, 256u);
+    Entry * newEntries = HeapNewNoThrowArrayZ(Entry, newCapacity);
+    if (newEntries == nullptr)
+    {
+        return false;
+    }
+
+    Entry * oldEntries = entries;
+    uint oldCapacity = capacity;
+    entries = newEntries;
+    capacity = newCapacity;
+    entryCount = 0;
+
+    for (uint i = 0; i < oldCapacity; i++)
+    {
+        if (oldEntries[i].key != EmptyKey)
+        {
+            Add(oldEntries[i].key, oldEntries[i].staleRuns);
+        }
+    }
+
+    if (oldEntries != nullptr)
+    {
+        HeapDeleteArray(oldCapacity, oldEntries);
+    }
+    return true;
+}
+
+bool
+JitWarmupCache::Read(CacheFileReadCallback readCallback, void * readContext)
+{
+    CacheFile file(Magic, FormatVersion);
+    if (!file.Read(readCallback, readContext))
+    {
+        return false;
+    }
+
+    const uint32 recordCount = file.GetRecordCount();
+    if (file.GetDataLength() % sizeof(Entry) != 0 || file.GetDataLength() / sizeof(Entry) != recordCount)
+    {
+        return false;
+    }
+
+    Entry const * fileEntries = reinterpret_cast<Entry const *>(file.GetData());
+    for (uint i = 0; i < recordCount; i++)
+    {
+        // Count this run as stale until the function is full JIT'ed again
+        uint64 key = fileEntries[i].key;
+        uint32 staleRuns = fileEntries[i].staleRuns;
+        if (key != EmptyKey && CacheFile::AgeRecord(&staleRuns) && Find(key) == nullptr)
+        {
+            Add(key, staleRuns);
+        }
+    }
+    return true;
+}
+
+bool
+JitWarmupCache::Write(CacheFileWriteCallback writeCallback, void * writeContext) const
+{
+    // Pack the entries at the start of a copy of the table, so that they go out in one write
+    Entry * fileEntries = HeapNewNoThrowArray(Entry, max(entryCount, 1u));
+    if (fileEntries == nullptr)
+    {
+        return false;
+    }
+
+    uint fileEntryCount = 0;
+    for (uint i = 0; i < capacity; i++)
+    {
+        if (entries[i].key != EmptyKey)
+        {
+            fileEntries[fileEntryCount++] = entries[i];
+        }
+    }
+    Assert(fileEntryCount == entryCount);
+
+    CacheFile file(Magic, FormatVersion);
+    bool succeeded = file.Write(fileEntryCount, writeCallback, writeContext, [&](CacheFile::RecordWriter& writer) -> bool
+    {
+        return writer.Write(fileEntries, fileEntryCount * sizeof(Entry));
+    });
+
+    HeapDeleteArray(max(entryCount, 1u), fileEntries);
+    return succeeded;
+}
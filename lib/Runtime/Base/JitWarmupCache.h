@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+/*
+ * JitWarmupCache remembers which functions were full JIT'ed, across runs of a process.
+ *
+ * Functions are keyed by a hash of their byte code, so a function only matches if it was compiled to the
+ * same byte code by the same version of the engine. When a function whose key was loaded from an earlier
+ * run gets its byte code, it skips simple JIT and is full JIT'ed after a short profiling period. The
+ * machine code itself isn't kept: it embeds the addresses of types, inline caches and other objects of the
+ * process that generated it. Compiling it again in the new process from a few iterations of fresh profile
+ * data also re-checks every speculative assumption the earlier code made.
+ *
+ * The cache is stored through CacheFile, and keys that aren't full JIT'ed again for CacheFile::MaxStaleRuns
+ * runs are dropped, so the cache follows changes to the scripts. Lookups and additions don't throw: running
+ * out of memory drops the key.
+ */
+class JitWarmupCache
+{
+public:
+    JitWarmupCache();
+    ~JitWarmupCache();
+
+    static uint64 GetKey(Js::ByteBlock * byteCodeBlock);
+
+    bool Contains(Js::ByteBlock * byteCodeBlock) const;
+    void AddFullJitFunction(Js::ByteBlock * byteCodeBlock);
+
+    // Returns false if the input couldn't be read, isn't a cache written by this version of the engine,
+    // or is damaged. An empty input is a valid, empty cache.
+    bool Read(CacheFileReadCallback readCallback, void * readContext);
+    // Returns false if the write callback failed
+    bool Write(CacheFileWriteCallback writeCallback, void * writeContext) const;
+
+private:
+    static const uint32 Magic = 0x634A6843; // "ChJc"
+    static const uint32 FormatVersion = 2;
+    static const uint64 EmptyKey = 0;
+
+    struct Entry
+    {
+        uint64 key;
+        uint32 staleRuns;
+        uint32 reserved;
+    };
+
+    Entry * Find(uint64 key) const;
+    bool Add(uint64 key, uint32 staleRuns);
+    bool Grow();
+
+    Entry * entries;
+    uint entryCount;
+    uint capacity;
+};
@@ -222,6 +222,8 @@ namespace Js
 
 #ifdef BGJIT_STATS
         interpretedCount = maxFuncInterpret = funcJITCount = bytecodeJITCount = interpretedCallsHighPri = jitCodeUsed = funcJitCodeUsed = loopJITCount = speculativeJitCount = 0;
+        memset(jitQueueWaitCount, 0, sizeof(jitQueueWaitCount));
+        memset(jitQueueWaitTime, 0, sizeof(jitQueueWaitTime));
 #endif
 
 #ifdef PROFILE_TYPES
@@ -1432,6 +1434,12 @@ namespace Js
                 }
 #endif
 
+                DynamicProfileCache * dynamicProfileCache = threadContext->GetDynamicProfileCache();
+                if (dynamicProfileCache != nullptr)
+                {
+                    dynamicProfileCache->SaveScriptContext(this);
+                }
+
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
                 this->ClearDynamicProfileList();
 #endif
@@ -5516,6 +5524,17 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
             Output::Print(_u("** TotalInterpretedCalls: %6d MaxFuncInterp: %6d  InterpretedHighPri: %6d \n"),
                 interpretedCount, maxFuncInterpret, interpretedCallsHighPri);
             Output::Print(_u("** ZeroInterpretedFunctions: %6d OneInterpretedFunctions: %6d ZeroInterpretedWithNonZeroBytecode: %6d \n "), zeroInterpretedFunctions, oneInterpretedFunctions, nonZeroBytecodeFunctions);
+            LARGE_INTEGER freq;
+            QueryPerformanceFrequency(&freq);
+            const auto AverageJitQueueWait = [&](JsUtil::JobPriority priority) -> double
+            {
+                const uint i = static_cast<uint>(priority);
+                return jitQueueWaitCount[i] == 0 ? 0 : jitQueueWaitTime[i] * 1000.0 / freq.QuadPart / jitQueueWaitCount[i];
+            };
+            Output::Print(_u("** JitQueueWait (count, avg mSec) High: %6d %10.6f Normal: %6d %10.6f Low: %6d %10.6f\n"),
+                jitQueueWaitCount[static_cast<uint>(JsUtil::JobPriority::High)], AverageJitQueueWait(JsUtil::JobPriority::High),
+                jitQueueWaitCount[static_cast<uint>(JsUtil::JobPriority::Normal)], AverageJitQueueWait(JsUtil::JobPriority::Normal),
+                jitQueueWaitCount[static_cast<uint>(JsUtil::JobPriority::Low)], AverageJitQueueWait(JsUtil::JobPriority::Low));
             Output::Print(_u("** %-24s : %-10s %-10s %-10s %-10s %-10s\n"), _u("InterpretedCounts"), _u("Total"), _u("NativeCode"), _u("Used"), _u("Usage"), _u("Rejits"));
             uint low = 0;
             uint high = 0;
@@ -686,6 +686,8 @@ public:
         uint jitCodeUsed;
         uint funcJitCodeUsed;
         uint speculativeJitCount;
+        uint jitQueueWaitCount[static_cast<uint>(JsUtil::JobPriority::Count)];
+        int64 jitQueueWaitTime[static_cast<uint>(JsUtil::JobPriority::Count)];    // in performance counter ticks
 #endif
 #if DBG
         // Count how many Out of Memory and Stack overflow exceptions happened during the execution
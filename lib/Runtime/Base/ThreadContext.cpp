@@ -109,6 +109,12 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #endif
         ),
     recycler(nullptr),
+    allocationSampleProfile(nullptr),
+    jitWarmupCache(nullptr),
+#if ENABLE_PROFILE_INFO
+    dynamicProfileCache(nullptr),
+    allocationSiteCollectionEpoch(0),
+#endif
     hasCollectionCallBack(false),
     callDispose(true),
 #if ENABLE_NATIVE_CODEGEN
@@ -443,6 +449,15 @@ ThreadContext::~ThreadContext()
     // If any dispose is allocating memory during shutdown, that is a bug
     pageAllocator.Close();
 
+#if ENABLE_PROFILE_INFO
+    // The script contexts closed below don't save their profiles, the cache can't be written after this
+    if (this->dynamicProfileCache != nullptr)
+    {
+        HeapDelete(this->dynamicProfileCache);
+        this->dynamicProfileCache = nullptr;
+    }
+#endif
+
     // The recycler need to delete before the background code gen thread
     // because that might run finalizer which need access to the background code gen thread.
     if (recycler != nullptr)
@@ -533,6 +548,18 @@ ThreadContext::~ThreadContext()
         HeapDelete(recycler);
     }
 
+    if (this->allocationSampleProfile != nullptr)
+    {
+        HeapDelete(this->allocationSampleProfile);
+        this->allocationSampleProfile = nullptr;
+    }
+
+    if (this->jitWarmupCache != nullptr)
+    {
+        HeapDelete(this->jitWarmupCache);
+        this->jitWarmupCache = nullptr;
+    }
+
 #if ENABLE_NATIVE_CODEGEN
     if(jobProcessor)
     {
@@ -758,9 +785,31 @@ Recycler* ThreadContext::EnsureRecycler()
     if (recycler == NULL)
     {
         AutoRecyclerPtr newRecycler(HeapNew(Recycler, GetAllocationPolicyManager(), &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags));
+#if ENABLE_HUGE_PAGE_SEGMENTS
+        if (this->TestThreadContextFlag(ThreadContextFlagHugePages))
+        {
+            newRecycler->EnableHugePages();
+        }
+#endif
+#if ENABLE_CONCURRENT_GC
+        if (this->TestThreadContextFlag(ThreadContextFlagBackgroundFinalize))
+        {
+            newRecycler->EnableBackgroundFinalize();
+        }
+#endif
         newRecycler->Initialize(isOptimizedForManyInstances, &threadService); // use in-thread GC when optimizing for many instances
         newRecycler->SetCollectionWrapper(this);
 
+        if (Js::Configuration::Global.flags.RecyclerAllocationSampleInterval != 0 &&
+            this->allocationSampleProfile == nullptr)
+        {
+            this->allocationSampleProfile = HeapNewNoThrow(AllocationSampleProfile);
+            if (this->allocationSampleProfile != nullptr)
+            {
+                newRecycler->SetAllocationSampleInterval((size_t)Js::Configuration::Global.flags.RecyclerAllocationSampleInterval * 1024);
+            }
+        }
+
 #if ENABLE_NATIVE_CODEGEN
         // This may throw, so it needs to be after the recycler is initialized,
         // otherwise, the recycler dtor may encounter problems
@@ -2565,6 +2614,11 @@ ThreadContext::PreCollectionCallBack(CollectionFlags flags)
     this->CleanNoCasePropertyMap();
     this->TryEnterExpirableCollectMode();
 
+#if ENABLE_PROFILE_INFO
+    // Allocation site samples taken from here on may be kept alive by this collection
+    this->allocationSiteCollectionEpoch++;
+#endif
+
     const BOOL concurrent = flags & CollectMode_Concurrent;
     const BOOL partial = flags & CollectMode_Partial;
 
@@ -2636,6 +2690,10 @@ ThreadContext::PostCollectionCallBack()
 
     TryExitExpirableCollectMode();
 
+#if ENABLE_PROFILE_INFO
+    this->UpdateAllocationSiteSamples();
+#endif
+
     // Recycler is null in the case where the ThreadContext is in the process of creating the recycler and
     // we have a GC triggered (say because the -recyclerStress flag is passed in)
     if (this->recycler != NULL)
@@ -2880,6 +2938,402 @@ ThreadContext::PreDisposeObjectsCallBack()
     this->expirableObjectDisposeList->Clear();
 }
 
+Js::RecyclableObject *
+ThreadContext::GetHeapSnapshotJavascriptObject(void * objectAddress, size_t objectSize)
+{
+    // The heap snapshot asks about every object in the heap, so only trust the ones whose
+    // type is a recycler object that belongs to one of our libraries
+    if (objectSize < sizeof(Js::RecyclableObject))
+    {
+        return nullptr;
+    }
+
+    // An object starts with its vtable, which is never in the recycler heap. Check it before
+    // trusting the type word that follows it.
+    INT_PTR vtable = VirtualTableInfoBase::GetVirtualTable(objectAddress);
+    if (vtable == 0 || this->recycler->IsValidObject((void *)vtable))
+    {
+        return nullptr;
+    }
+
+    Js::Type * type = ((Js::RecyclableObject *)objectAddress)->GetType();
+    if (!this->recycler->IsValidObject(type, sizeof(Js::Type)))
+    {
+        return nullptr;
+    }
+
+    if ((uint)type->GetTypeId() >= (uint)Js::TypeIds_Limit)
+    {
+        return nullptr;
+    }
+
+    for (Js::ScriptContext * scriptContext = GetScriptContextList(); scriptContext; scriptContext = scriptContext->next)
+    {
+        if (scriptContext->GetLibrary() == type->GetLibrary())
+        {
+            return (Js::RecyclableObject *)objectAddress;
+        }
+    }
+    return nullptr;
+}
+
+char16 const *
+ThreadContext::GetHeapSnapshotObjectName(void * objectAddress, size_t objectSize)
+{
+    Js::RecyclableObject * object = GetHeapSnapshotJavascriptObject(objectAddress, objectSize);
+    if (object == nullptr)
+    {
+        return nullptr;
+    }
+
+    switch (object->GetTypeId())
+    {
+    case Js::TypeIds_Number:
+    case Js::TypeIds_Int64Number:
+    case Js::TypeIds_UInt64Number:
+    case Js::TypeIds_NumberObject:
+        return _u("Number");
+    case Js::TypeIds_String:
+    case Js::TypeIds_StringObject:
+        return _u("String");
+    case Js::TypeIds_Symbol:
+    case Js::TypeIds_SymbolObject:
+        return _u("Symbol");
+    case Js::TypeIds_BooleanObject:
+        return _u("Boolean");
+    case Js::TypeIds_Function:
+        return _u("Function");
+    case Js::TypeIds_Proxy:
+        return _u("Proxy");
+    case Js::TypeIds_Object:
+        return _u("Object");
+    case Js::TypeIds_Array:
+    case Js::TypeIds_NativeIntArray:
+#if ENABLE_COPYONACCESS_ARRAY
+    case Js::TypeIds_CopyOnAccessNativeIntArray:
+#endif
+    case Js::TypeIds_NativeFloatArray:
+    case Js::TypeIds_ES5Array:
+        return _u("Array");
+    case Js::TypeIds_Date:
+    case Js::TypeIds_WinRTDate:
+        return _u("Date");
+    case Js::TypeIds_RegEx:
+        return _u("RegExp");
+    case Js::TypeIds_Error:
+        return _u("Error");
+    case Js::TypeIds_Arguments:
+        return _u("Arguments");
+    case Js::TypeIds_ArrayBuffer:
+        return _u("ArrayBuffer");
+    case Js::TypeIds_SharedArrayBuffer:
+        return _u("SharedArrayBuffer");
+    case Js::TypeIds_Int8Array:
+        return _u("Int8Array");
+    case Js::TypeIds_Uint8Array:
+        return _u("Uint8Array");
+    case Js::TypeIds_Uint8ClampedArray:
+        return _u("Uint8ClampedArray");
+    case Js::TypeIds_Int16Array:
+        return _u("Int16Array");
+    case Js::TypeIds_Uint16Array:
+        return _u("Uint16Array");
+    case Js::TypeIds_Int32Array:
+        return _u("Int32Array");
+    case Js::TypeIds_Uint32Array:
+        return _u("Uint32Array");
+    case Js::TypeIds_Float32Array:
+        return _u("Float32Array");
+    case Js::TypeIds_Float64Array:
+        return _u("Float64Array");
+    case Js::TypeIds_DataView:
+        return _u("DataView");
+    case Js::TypeIds_Map:
+        return _u("Map");
+    case Js::TypeIds_Set:
+        return _u("Set");
+    case Js::TypeIds_WeakMap:
+        return _u("WeakMap");
+    case Js::TypeIds_WeakSet:
+        return _u("WeakSet");
+    case Js::TypeIds_ArrayIterator:
+        return _u("Array Iterator");
+    case Js::TypeIds_MapIterator:
+        return _u("Map Iterator");
+    case Js::TypeIds_SetIterator:
+        return _u("Set Iterator");
+    case Js::TypeIds_StringIterator:
+        return _u("String Iterator");
+    case Js::TypeIds_Generator:
+        return _u("Generator");
+    case Js::TypeIds_Promise:
+        return _u("Promise");
+    case Js::TypeIds_WebAssemblyModule:
+        return _u("WebAssembly.Module");
+    case Js::TypeIds_WebAssemblyInstance:
+        return _u("WebAssembly.Instance");
+    case Js::TypeIds_WebAssemblyMemory:
+        return _u("WebAssembly.Memory");
+    case Js::TypeIds_WebAssemblyTable:
+        return _u("WebAssembly.Table");
+    case Js::TypeIds_GlobalObject:
+        return _u("(global)");
+    case Js::TypeIds_ActivationObject:
+        return _u("(closure scope)");
+    default:
+        return _u("(javascript object)");
+    }
+}
+
+bool
+ThreadContext::HasHeapSnapshotSlotsVirtualTable(Js::RecyclableObject * object)
+{
+    // The objects whose slots the heap snapshot reads, matched on their exact vtable
+    return
+        VirtualTableInfo<Js::DynamicObject>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::CrossSiteObject<Js::DynamicObject>>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::JavascriptArray>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::JavascriptNativeIntArray>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::JavascriptNativeFloatArray>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::ScriptFunction>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::JavascriptGeneratorFunction>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::JavascriptAsyncFunction>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::ActivationObject>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::ActivationObjectEx>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::BlockActivationObject>::HasVirtualTable(object) ||
+        VirtualTableInfo<Js::GlobalObject>::HasVirtualTable(object);
+}
+
+void
+ThreadContext::ForEachHeapSnapshotReference(void * objectAddress, size_t objectSize, RecyclerHeapSnapshotReferenceCallback callback, void * context)
+{
+    Js::RecyclableObject * object = GetHeapSnapshotJavascriptObject(objectAddress, objectSize);
+    if (object == nullptr || !Js::DynamicType::Is(object->GetTypeId()) || !HasHeapSnapshotSlotsVirtualTable(object))
+    {
+        return;
+    }
+
+    // Only look at the data properties that live in a slot, this must not call getters or allocate
+    Js::DynamicObject * dynamicObject = Js::DynamicObject::UnsafeFromVar(object);
+    Js::DynamicTypeHandler * typeHandler = dynamicObject->GetTypeHandler();
+    Js::ScriptContext * scriptContext = object->GetScriptContext();
+    int propertyCount = typeHandler->GetPropertyCount();
+    for (int i = 0; i < propertyCount; i++)
+    {
+        Js::PropertyId propertyId = typeHandler->GetPropertyId(scriptContext, (Js::BigPropertyIndex)i);
+        if (propertyId == Js::Constants::NoProperty)
+        {
+            continue;
+        }
+
+        Js::PropertyRecord const * propertyRecord = this->GetPropertyName(propertyId);
+        Js::PropertyIndex slotIndex = typeHandler->GetPropertyIndex(propertyRecord);
+        if (slotIndex == Js::Constants::NoSlot)
+        {
+            continue;
+        }
+
+        callback(context, propertyRecord->GetBuffer(), dynamicObject->GetSlot(slotIndex));
+    }
+}
+
+#if ENABLE_PROFILE_INFO
+void
+ThreadContext::AddAllocationSiteSample(Js::DynamicProfileInfo * profileInfo, uint siteIndex, Js::RecyclableObject * object)
+{
+    // Drop the sample if too many are already waiting for a collection
+    if (this->recyclableData->allocationSiteSampleCount == Js::AllocationSiteSample::MaxPending)
+    {
+        return;
+    }
+
+    // Creating the weak reference may collect, which updates the samples
+    RecyclerWeakReference<Js::RecyclableObject> * weakObject = this->recycler->CreateWeakReferenceHandle(object);
+    if (this->recyclableData->allocationSiteSampleCount == Js::AllocationSiteSample::MaxPending)
+    {
+        return;
+    }
+
+    Js::AllocationSiteSample& sample = this->recyclableData->allocationSiteSamples[this->recyclableData->allocationSiteSampleCount++];
+    sample.object = weakObject;
+    sample.profileInfo = profileInfo;
+    sample.siteIndex = siteIndex;
+    sample.collectionEpoch = this->allocationSiteCollectionEpoch;
+}
+
+void
+ThreadContext::UpdateAllocationSiteSamples()
+{
+    if (this->recyclableData == nullptr)
+    {
+        return;
+    }
+
+    Field(Js::AllocationSiteSample) * samples = this->recyclableData->allocationSiteSamples;
+    const uint sampleCount = this->recyclableData->allocationSiteSampleCount;
+    uint pendingCount = 0;
+    for (uint i = 0; i < sampleCount; i++)
+    {
+        if (samples[i].collectionEpoch == this->allocationSiteCollectionEpoch)
+        {
+            // Allocated while this collection was running, which may have kept it alive anyway
+            samples[pendingCount++] = samples[i];
+            continue;
+        }
+
+        samples[i].profileInfo->RecordAllocationSiteSurvival(samples[i].siteIndex, samples[i].object->Get() != nullptr);
+    }
+
+    for (uint i = pendingCount; i < sampleCount; i++)
+    {
+        samples[i].object = nullptr;
+        samples[i].profileInfo = nullptr;
+    }
+    this->recyclableData->allocationSiteSampleCount = pendingCount;
+}
+#endif
+
+void
+ThreadContext::AllocationSampleCallBack(size_t size, size_t sampledBytes)
+{
+    if (this->allocationSampleProfile == nullptr)
+    {
+        return;
+    }
+
+    // Called from inside the allocation, so the walk must not allocate from the recycler or throw.
+    // Outside of script the sample is charged to the root.
+    AllocationSampleProfile::Frame frames[AllocationSampleProfile::MaxStackDepth];
+    uint frameCount = 0;
+    bool truncated = false;
+    if (this->entryExitRecord != nullptr)
+    {
+        Js::JavascriptStackWalker walker(this->entryExitRecord->scriptContext, TRUE);
+        Js::JavascriptFunction * javascriptFunction = nullptr;
+        while (walker.GetCaller(&javascriptFunction))
+        {
+            if (javascriptFunction == nullptr || !Js::ScriptFunction::Test(javascriptFunction))
+            {
+                continue;
+            }
+
+            // Keep the innermost frames, and mark the stack if there are more script frames above them
+            if (frameCount == AllocationSampleProfile::MaxStackDepth)
+            {
+                truncated = true;
+                break;
+            }
+
+            Js::FunctionBody * functionBody = javascriptFunction->GetFunctionBody();
+            frames[frameCount].functionBody = functionBody;
+            frames[frameCount].sourceInfoId = functionBody->GetUtf8SourceInfo()->GetSourceInfoId();
+            frames[frameCount].functionId = functionBody->GetLocalFunctionId();
+            frameCount++;
+        }
+
+        // The walk goes from the innermost frame out, the profile wants the outermost first
+        for (uint i = 0; i < frameCount / 2; i++)
+        {
+            AllocationSampleProfile::Frame frame = frames[i];
+            frames[i] = frames[frameCount - 1 - i];
+            frames[frameCount - 1 - i] = frame;
+        }
+    }
+
+    // Running out of memory just drops the sample
+    this->allocationSampleProfile->AddSample(frames, frameCount, truncated, sampledBytes);
+}
+
+bool
+ThreadContext::StartAllocationSampling(size_t sampleInterval)
+{
+    Assert(sampleInterval != 0);
+
+    // A new run starts a new profile
+    AllocationSampleProfile * profile = HeapNewNoThrow(AllocationSampleProfile);
+    if (profile == nullptr)
+    {
+        return false;
+    }
+
+    if (this->allocationSampleProfile != nullptr)
+    {
+        HeapDelete(this->allocationSampleProfile);
+    }
+    this->allocationSampleProfile = profile;
+    this->EnsureRecycler()->SetAllocationSampleInterval(sampleInterval);
+    return true;
+}
+
+void
+ThreadContext::StopAllocationSampling()
+{
+    if (this->recycler != nullptr)
+    {
+        this->recycler->SetAllocationSampleInterval(0);
+    }
+}
+
+bool
+ThreadContext::LoadJitWarmupCache(CacheFileReadCallback readCallback, void * readContext)
+{
+    // Loading replaces the functions recorded so far
+    JitWarmupCache * cache = HeapNewNoThrow(JitWarmupCache);
+    if (cache == nullptr)
+    {
+        return false;
+    }
+
+    if (!cache->Read(readCallback, readContext))
+    {
+        HeapDelete(cache);
+        return false;
+    }
+
+    if (this->jitWarmupCache != nullptr)
+    {
+        HeapDelete(this->jitWarmupCache);
+    }
+    this->jitWarmupCache = cache;
+    return true;
+}
+
+JitWarmupCache *
+ThreadContext::EnsureJitWarmupCache()
+{
+    if (this->jitWarmupCache == nullptr)
+    {
+        this->jitWarmupCache = HeapNewNoThrow(JitWarmupCache);
+    }
+    return this->jitWarmupCache;
+}
+
+#if ENABLE_PROFILE_INFO
+bool
+ThreadContext::LoadDynamicProfileCache(CacheFileReadCallback readCallback, void * readContext)
+{
+    // Loading replaces the profiles saved so far
+    Js::DynamicProfileCache * cache = HeapNewNoThrow(Js::DynamicProfileCache);
+    if (cache == nullptr)
+    {
+        return false;
+    }
+
+    if (!cache->Read(readCallback, readContext))
+    {
+        HeapDelete(cache);
+        return false;
+    }
+
+    if (this->dynamicProfileCache != nullptr)
+    {
+        HeapDelete(this->dynamicProfileCache);
+    }
+    this->dynamicProfileCache = cache;
+    return true;
+}
+#endif
+
 #ifdef FAULT_INJECTION
 void
 ThreadContext::DisposeScriptContextByFaultInjectionCallBack()
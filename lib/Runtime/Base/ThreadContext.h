@@ -43,6 +43,8 @@ enum ThreadContextFlags
     ThreadContextFlagCanDisableExecution           = 0x00000001,
     ThreadContextFlagEvalDisabled                  = 0x00000002,
     ThreadContextFlagNoJIT                         = 0x00000004,
+    ThreadContextFlagHugePages                     = 0x00000008,
+    ThreadContextFlagBackgroundFinalize            = 0x00000010,
 };
 
 const int LS_MAX_STACK_SIZE_KB = 300;
@@ -621,6 +623,12 @@ private:
 
         Field(uint) constructorCacheInvalidationCount;
 
+#if ENABLE_PROFILE_INFO
+        // Objects sampled at allocation sites, checked for survival after the next collection
+        Field(Js::AllocationSiteSample) allocationSiteSamples[Js::AllocationSiteSample::MaxPending];
+        Field(uint) allocationSiteSampleCount;
+#endif
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         // use for autoProxy called from Debug.setAutoProxyName. we need to keep the buffer from GetSz() alive.
         Field(LPCWSTR) autoProxyName;
@@ -653,6 +661,11 @@ private:
 #endif
     IdleDecommitPageAllocator pageAllocator;
     Recycler* recycler;
+    AllocationSampleProfile * allocationSampleProfile;
+    JitWarmupCache * jitWarmupCache;
+#if ENABLE_PROFILE_INFO
+    Js::DynamicProfileCache * dynamicProfileCache;
+#endif
 
     // Fake RecyclerWeakReference for built-in properties
     class StaticPropertyRecordReference : public RecyclerWeakReference<const Js::PropertyRecord>
@@ -1639,6 +1652,35 @@ public:
 #endif
     virtual void DisposeObjects(Recycler * recycler) override;
     virtual void PreDisposeObjectsCallBack() override;
+    virtual char16 const * GetHeapSnapshotObjectName(void * objectAddress, size_t objectSize) override;
+    virtual void ForEachHeapSnapshotReference(void * objectAddress, size_t objectSize, RecyclerHeapSnapshotReferenceCallback callback, void * context) override;
+    Js::RecyclableObject * GetHeapSnapshotJavascriptObject(void * objectAddress, size_t objectSize);
+    static bool HasHeapSnapshotSlotsVirtualTable(Js::RecyclableObject * object);
+    virtual void AllocationSampleCallBack(size_t size, size_t sampledBytes) override;
+
+    // Allocation sampling keeps its profile after it stops so it can still be written out
+    bool StartAllocationSampling(size_t sampleInterval);
+    void StopAllocationSampling();
+    AllocationSampleProfile * GetAllocationSampleProfile() const { return allocationSampleProfile; }
+
+    // Functions are only looked up in and added to the JIT warm-up cache once one has been loaded or written
+    bool LoadJitWarmupCache(CacheFileReadCallback readCallback, void * readContext);
+    JitWarmupCache * GetJitWarmupCache() const { return jitWarmupCache; }
+    JitWarmupCache * EnsureJitWarmupCache();
+
+#if ENABLE_PROFILE_INFO
+    // Profiles are only looked up in and saved to the dynamic profile cache once one has been loaded
+    bool LoadDynamicProfileCache(CacheFileReadCallback readCallback, void * readContext);
+    Js::DynamicProfileCache * GetDynamicProfileCache() const { return dynamicProfileCache; }
+#endif
+
+#if ENABLE_PROFILE_INFO
+    void AddAllocationSiteSample(Js::DynamicProfileInfo * profileInfo, uint siteIndex, Js::RecyclableObject * object);
+private:
+    void UpdateAllocationSiteSamples();
+    uint allocationSiteCollectionEpoch;
+public:
+#endif
 
     typedef DList<ExpirableObject*, ArenaAllocator> ExpirableObjectList;
     ExpirableObjectList* expirableObjectList;
@@ -3934,6 +3934,9 @@ public:
             current = ReadSmallSpanSequence(current, &(*functionBody)->m_sourceInfo.pSpanSequence);
 
             (*functionBody)->executionState.InitializeExecutionModeAndLimits(*functionBody);
+#if ENABLE_NATIVE_CODEGEN
+            (*functionBody)->CheckJitWarmupCache();
+#endif
         }
 
         // Read lexically nested functions
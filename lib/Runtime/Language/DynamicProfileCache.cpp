@@ -0,0 +1,254 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+#if ENABLE_PROFILE_INFO
+namespace Js
+{
+    DynamicProfileCache::DynamicProfileCache() :
+        records(&HeapAllocator::Instance)
+    {
+    }
+
+    DynamicProfileCache::~DynamicProfileCache()
+    {
+        records.Map([](uint64, Record * record)
+        {
+            DeleteRecord(record);
+        });
+    }
+
+    bool
+    DynamicProfileCache::CanPersist(FunctionBody * functionBody)
+    {
+        // Dynamic sources with a source profile manager get their profiles from the host's in-memory cache
+        SourceContextInfo * sourceContextInfo = functionBody->GetSourceContextInfo();
+        return
+            !(sourceContextInfo->IsDynamic() && sourceContextInfo->sourceDynamicProfileManager != nullptr) &&
+            !functionBody->GetUtf8SourceInfo()->GetIsLibraryCode() &&
+            !functionBody->IsInDebugMode() &&
+            functionBody->LengthInBytes() != 0 &&
+            DynamicProfileInfo::IsEnabled(functionBody);
+    }
+
+    uint64
+    DynamicProfileCache::GetKey(FunctionBody * functionBody)
+    {
+        return CacheFile::GetKey(functionBody->GetSource(_u("DynamicProfileCache::GetKey")), functionBody->LengthInBytes());
+    }
+
+    void
+    DynamicProfileCache::DeleteRecord(Record * record)
+    {
+        HeapDeletePlus(record->GetPayloadLength(), record);
+    }
+
+    void
+    DynamicProfileCache::AddRecord(Record * record)
+    {
+        Record * oldRecord;
+        if (records.TryGetValue(record->key, &oldRecord))
+        {
+            records.Item(record->key, record);
+            DeleteRecord(oldRecord);
+            return;
+        }
+
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+            records.Add(record->key, record);
+        }
+        catch (OutOfMemoryException)
+        {
+            DeleteRecord(record);
+        }
+    }
+
+    DynamicProfileInfo *
+    DynamicProfileCache::LoadDynamicProfileInfo(FunctionBody * functionBody)
+    {
+        if (records.Count() == 0 || !CanPersist(functionBody))
+        {
+            return nullptr;
+        }
+
+        Record * record;
+        if (!records.TryGetValue(GetKey(functionBody), &record) || record->loopCount != functionBody->GetLoopCount())
+        {
+            return nullptr;
+        }
+
+        BufferReader reader(record->GetProfile(), record->profileLength);
+        LocalFunctionId functionId;
+        DynamicProfileInfo * dynamicProfileInfo = DynamicProfileInfo::Deserialize(&reader, functionBody->GetScriptContext()->GetRecycler(), &functionId);
+        if (dynamicProfileInfo == nullptr || !dynamicProfileInfo->MatchFunctionBody(functionBody))
+        {
+            return nullptr;
+        }
+
+        // The profile already holds the types the full JIT needs, the few profiled calls left only confirm them
+        if (record->profiledCallCount >= FunctionBody::GetMinFunctionProfileIterations())
+        {
+            functionBody->SetIsJitWarmupCandidate(static_cast<uint16>(CONFIG_FLAG(PersistedProfileFullJitThreshold)));
+        }
+
+        // Loops that were hot enough for loop body JIT start profiling right away
+        const uint32 * loopCounts = record->GetLoopCounts();
+        functionBody->MapLoopHeaders([&](const uint loopNumber, LoopHeader *const loopHeader)
+        {
+            const uint loopInterpretCount = functionBody->GetLoopInterpretCount(loopHeader);
+            const uint loopProfileThreshold = functionBody->GetLoopProfileThreshold(loopInterpretCount);
+            if (loopCounts[loopNumber] > loopInterpretCount &&
+                loopProfileThreshold < loopInterpretCount &&
+                loopHeader->interpretCount < loopProfileThreshold)
+            {
+                loopHeader->interpretCount = loopProfileThreshold;
+            }
+        });
+
+        return dynamicProfileInfo;
+    }
+
+    void
+    DynamicProfileCache::SaveScriptContext(ScriptContext * scriptContext)
+    {
+        scriptContext->MapFunction([this](FunctionBody * functionBody)
+        {
+            if (functionBody->HasExecutionDynamicProfileInfo() &&
+                functionBody->GetByteCode() != nullptr &&
+                CanPersist(functionBody))
+            {
+                SaveFunction(functionBody);
+            }
+        });
+    }
+
+    void
+    DynamicProfileCache::SaveFunction(FunctionBody * functionBody)
+    {
+        DynamicProfileInfo * dynamicProfileInfo = functionBody->GetDynamicProfileInfo();
+        if (!dynamicProfileInfo->HasFunctionBody())
+        {
+            return;
+        }
+
+        BufferSizeCounter counter;
+        if (!dynamicProfileInfo->Serialize(&counter, functionBody) || counter.GetByteCount() > UINT_MAX / 2)
+        {
+            return;
+        }
+
+        const uint loopCount = functionBody->GetLoopCount();
+        const size_t payloadLength = loopCount * sizeof(uint32) + counter.GetByteCount();
+        Record * record = HeapNewNoThrowPlus(payloadLength, Record);
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        record->key = GetKey(functionBody);
+        record->staleRuns = 0;
+        record->profiledCallCount = functionBody->GetProfiledIterations();
+        record->loopCount = loopCount;
+        record->profileLength = static_cast<uint32>(counter.GetByteCount());
+
+        uint32 * loopCounts = record->GetLoopCounts();
+        for (uint i = 0; i < loopCount; i++)
+        {
+            loopCounts[i] = 0;
+        }
+        functionBody->MapLoopHeaders([loopCounts](const uint loopNumber, LoopHeader *const loopHeader)
+        {
+            loopCounts[loopNumber] = loopHeader->interpretCount;
+        });
+
+        BufferWriter writer(record->GetProfile(), record->profileLength);
+        if (!dynamicProfileInfo->Serialize(&writer, functionBody))
+        {
+            Assert(false);
+            DeleteRecord(record);
+            return;
+        }
+
+        AddRecord(record);
+    }
+
+    bool
+    DynamicProfileCache::Read(CacheFileReadCallback readCallback, void * readContext)
+    {
+        CacheFile file(Magic, FormatVersion);
+        if (!file.Read(readCallback, readContext))
+        {
+            return false;
+        }
+
+        const char * data = file.GetData();
+        const size_t dataLength = file.GetDataLength();
+        const uint32 recordCount = file.GetRecordCount();
+
+        // Validate all the records before taking any of them
+        bool succeeded = true;
+        size_t offset = 0;
+        for (uint i = 0; succeeded && i < recordCount; i++)
+        {
+            Record recordHeader;
+            succeeded = dataLength - offset >= sizeof(Record);
+            if (succeeded)
+            {
+                memcpy_s(&recordHeader, sizeof(Record), data + offset, sizeof(Record));
+                succeeded =
+                    recordHeader.loopCount <= dataLength / sizeof(uint32) &&
+                    recordHeader.profileLength <= dataLength &&
+                    dataLength - offset >= recordHeader.GetLength();
+                offset += succeeded ? recordHeader.GetLength() : 0;
+            }
+        }
+        if (!succeeded || offset != dataLength)
+        {
+            return false;
+        }
+
+        offset = 0;
+        for (uint i = 0; i < recordCount; i++)
+        {
+            Record recordHeader;
+            memcpy_s(&recordHeader, sizeof(Record), data + offset, sizeof(Record));
+            const size_t recordLength = recordHeader.GetLength();
+
+            // Count this run as stale until the function's profile is saved again
+            uint32 staleRuns = recordHeader.staleRuns;
+            if (CacheFile::AgeRecord(&staleRuns) && !records.ContainsKey(recordHeader.key))
+            {
+                Record * record = HeapNewNoThrowPlus(recordHeader.GetPayloadLength(), Record);
+                if (record != nullptr)
+                {
+                    memcpy_s(record, recordLength, data + offset, recordLength);
+                    record->staleRuns = staleRuns;
+                    AddRecord(record);
+                }
+            }
+            offset += recordLength;
+        }
+        return true;
+    }
+
+    bool
+    DynamicProfileCache::Write(CacheFileWriteCallback writeCallback, void * writeContext) const
+    {
+        CacheFile file(Magic, FormatVersion);
+        return file.Write(static_cast<uint32>(records.Count()), writeCallback, writeContext, [&](CacheFile::RecordWriter& writer) -> bool
+        {
+            bool succeeded = true;
+            records.MapUntil([&](uint64, Record * record)
+            {
+                succeeded = writer.Write(record, record->GetLength());
+                return !succeeded;
+            });
+            return succeeded;
+        });
+    }
+}
+#endif
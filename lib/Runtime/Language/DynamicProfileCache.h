@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_PROFILE_INFO
+namespace Js
+{
+    /*
+     * DynamicProfileCache carries the dynamic profiles of functions across runs of a process.
+     *
+     * For every function that ran with a profile, the cache keeps its serialized DynamicProfileInfo (the types seen by
+     * its parameters, fields, elements, calls, returns and loops, and the optimizations the JIT had to back off from),
+     * the number of calls the profile was collected over and the number of times each of its loops was interpreted.
+     * Functions are keyed by a hash of their source, and a profile is only attached to a function whose profiled
+     * operation counts match it.
+     *
+     * A function that gets its profile from the cache starts with it instead of an empty one. If the profile was
+     * collected over enough calls, the function skips simple JIT and is full JIT'ed after a few calls, and its loops
+     * that were hot enough for loop body JIT start profiling on their first iteration. The cache is stored through
+     * CacheFile, and profiles that aren't saved again for CacheFile::MaxStaleRuns runs are dropped.
+     */
+    class DynamicProfileCache
+    {
+    public:
+        DynamicProfileCache();
+        ~DynamicProfileCache();
+
+        // Returns the profile saved for the function, or nullptr. Called once the function has byte code.
+        DynamicProfileInfo * LoadDynamicProfileInfo(FunctionBody * functionBody);
+        // Saves the profiles of the functions of the script context that ran. Running out of memory drops the profile.
+        void SaveScriptContext(ScriptContext * scriptContext);
+
+        // Returns false if the input couldn't be read, isn't a cache written by this version of the engine,
+        // or is damaged. An empty input is a valid, empty cache.
+        bool Read(CacheFileReadCallback readCallback, void * readContext);
+        // Returns false if the write callback failed
+        bool Write(CacheFileWriteCallback writeCallback, void * writeContext) const;
+
+    private:
+        static const uint32 Magic = 0x70446843; // "ChDp"
+        static const uint32 FormatVersion = 1;
+
+        // A record is followed by the loop counts of the function and its serialized profile, and is written out as is
+        struct Record
+        {
+            uint64 key;
+            uint32 staleRuns;
+            uint32 profiledCallCount;
+            uint32 loopCount;
+            uint32 profileLength;
+
+            size_t GetPayloadLength() const { return loopCount * sizeof(uint32) + profileLength; }
+            size_t GetLength() const { return sizeof(Record) + GetPayloadLength(); }
+            uint32 * GetLoopCounts() { return reinterpret_cast<uint32 *>(this + 1); }
+            char * GetProfile() { return reinterpret_cast<char *>(GetLoopCounts() + loopCount); }
+        };
+
+        typedef JsUtil::BaseDictionary<uint64, Record *, HeapAllocator> RecordMap;
+
+        static bool CanPersist(FunctionBody * functionBody);
+        static uint64 GetKey(FunctionBody * functionBody);
+        static void DeleteRecord(Record * record);
+
+        void SaveFunction(FunctionBody * functionBody);
+        void AddRecord(Record * record);
+
+        RecordMap records;
+    };
+}
+#endif
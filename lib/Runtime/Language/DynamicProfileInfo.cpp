@@ -7,12 +7,12 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
+        rejitCount = 0;
+        bailOutOffsetForLastRejit = Js::Constants::NoByteCodeOffset;
     }
-#endif
 
     struct Allocation
     {
@@ -62,6 +62,7 @@ namespace Js
             { (uint)offsetof(DynamicProfileInfo, ldElemInfo), functionBody->GetProfiledLdElemCount() * sizeof(LdElemInfo) },
             { (uint)offsetof(DynamicProfileInfo, stElemInfo), functionBody->GetProfiledStElemCount() * sizeof(StElemInfo) },
             { (uint)offsetof(DynamicProfileInfo, arrayCallSiteInfo), functionBody->GetProfiledArrayCallSiteCount() * sizeof(ArrayCallSiteInfo) },
+            { (uint)offsetof(DynamicProfileInfo, allocationSiteInfo), functionBody->GetObjLiteralCount() * sizeof(AllocationSiteInfo) },
             { (uint)offsetof(DynamicProfileInfo, fldInfo), functionBody->GetProfiledFldCount() * sizeof(FldInfo) },
             { (uint)offsetof(DynamicProfileInfo, divideTypeInfo), functionBody->GetProfiledDivOrRemCount() * sizeof(ValueType) },
             { (uint)offsetof(DynamicProfileInfo, switchTypeInfo), functionBody->GetProfiledSwitchCount() * sizeof(ValueType)},
@@ -950,6 +951,65 @@ namespace Js
         return &arrayCallSiteInfo[index];
     }
 
+    bool DynamicProfileInfo::IsAllocationSitePretenured(FunctionBody *functionBody, uint siteIndex) const
+    {
+        Assert(siteIndex < functionBody->GetObjLiteralCount());
+
+        // A profile loaded from storage has no allocation site information
+        return allocationSiteInfo != nullptr && allocationSiteInfo[siteIndex].IsPretenured();
+    }
+
+    void DynamicProfileInfo::RecordAllocationSite(FunctionBody *functionBody, uint siteIndex, RecyclableObject *object)
+    {
+        Assert(siteIndex < functionBody->GetObjLiteralCount());
+        if (allocationSiteInfo == nullptr)
+        {
+            return;
+        }
+
+        AllocationSiteInfo * siteInfo = &allocationSiteInfo[siteIndex];
+        if (siteInfo->allocationsUntilSample != 0)
+        {
+            siteInfo->allocationsUntilSample--;
+            return;
+        }
+
+        const uint sampleInterval = max((uint)CONFIG_FLAG(PretenureSampleInterval), 1u);
+        siteInfo->allocationsUntilSample = (uint16)min(sampleInterval - 1, (uint)UINT16_MAX);
+        functionBody->GetScriptContext()->GetThreadContext()->AddAllocationSiteSample(this, siteIndex, object);
+    }
+
+    void DynamicProfileInfo::RecordAllocationSiteSurvival(uint siteIndex, bool survived)
+    {
+        AllocationSiteInfo * siteInfo = &allocationSiteInfo[siteIndex];
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        const bool wasPretenured = siteInfo->IsPretenured();
+#endif
+        if (survived)
+        {
+            siteInfo->survivedSampleCount++;
+        }
+        else
+        {
+            siteInfo->diedSampleCount++;
+        }
+
+        // Decay the counts so that a site whose objects stop surviving stops being pretenured
+        if ((uint)siteInfo->survivedSampleCount + siteInfo->diedSampleCount >= AllocationSiteInfo::MaxSampleCount)
+        {
+            siteInfo->survivedSampleCount /= 2;
+            siteInfo->diedSampleCount /= 2;
+        }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        if (PHASE_TESTTRACE1(Js::PretenurePhase) && siteInfo->IsPretenured() != wasPretenured)
+        {
+            Output::Print(_u("Pretenure: allocation site %u is %s\n"), siteIndex, wasPretenured ? _u("no longer pretenured") : _u("pretenured"));
+            Output::Flush();
+        }
+#endif
+    }
+
     void DynamicProfileInfo::RecordFieldAccess(FunctionBody* functionBody, uint fieldAccessId, Var object, FldInfoFlags flags)
     {
         Assert(fieldAccessId < functionBody->GetProfiledFldCount());
@@ -1220,7 +1280,7 @@ namespace Js
             return false;
         }
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         this->functionBody = functionBody;
 #endif
 
@@ -1833,25 +1893,24 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
 #if DBG_DUMP
-    void BufferWriter::Log(DynamicProfileInfo* info)
+    void BufferWriter::Log(DynamicProfileInfo* info, FunctionBody* functionBody)
     {
-        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, info->GetFunctionBody()->GetSourceContextId(), info->GetFunctionBody()->GetLocalFunctionId()))
+        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, functionBody->GetSourceContextId(), functionBody->GetLocalFunctionId()))
         {
             Output::Print(_u("Saving:"));
-            info->Dump(info->GetFunctionBody());
+            info->Dump(functionBody);
         }
     }
 #endif
 
     template <typename T>
-    bool DynamicProfileInfo::Serialize(T * writer)
+    bool DynamicProfileInfo::Serialize(T * writer, FunctionBody * functionBody)
     {
+        Assert(this->hasFunctionBody);
 #if DBG_DUMP
-        writer->Log(this);
+        writer->Log(this, functionBody);
 #endif
-        FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
         if (!writer->Write(functionBody->GetLocalFunctionId())
             || !writer->Write(paramInfoCount)
@@ -2114,12 +2173,14 @@ namespace Js
             dynamicProfileFunctionInfo->returnTypeInfoCount = returnTypeInfoCount;
             dynamicProfileFunctionInfo->loopCount = loopCount;
 
-            DynamicProfileInfo * dynamicProfileInfo = RecyclerNew(recycler, DynamicProfileInfo);
+            DynamicProfileInfo * dynamicProfileInfo = RecyclerNewZ(recycler, DynamicProfileInfo);
             dynamicProfileInfo->dynamicProfileFunctionInfo = dynamicProfileFunctionInfo;
             dynamicProfileInfo->parameterInfo = paramInfo;
             dynamicProfileInfo->ldElemInfo = ldElemInfo;
             dynamicProfileInfo->stElemInfo = stElemInfo;
             dynamicProfileInfo->arrayCallSiteInfo = arrayCallSiteInfo;
+            // Allocation site survival only describes the current process, it isn't persisted
+            dynamicProfileInfo->allocationSiteInfo = nullptr;
             dynamicProfileInfo->fldInfo = fldInfo;
             dynamicProfileInfo->slotInfo = slotInfo;
             dynamicProfileInfo->callSiteInfo = callSiteInfo;
@@ -2148,9 +2209,10 @@ namespace Js
 
     // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
     template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, Js::LocalFunctionId *);
-    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
-    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*);
+    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*, FunctionBody*);
+    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*, FunctionBody*);
 
+#ifdef DYNAMIC_PROFILE_STORAGE
     void DynamicProfileInfo::UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext)
     {
         // We don't clear old dynamic data here, because if a function is inlined, it will never go through the
@@ -319,6 +319,37 @@ namespace Js
         static byte const NotNativeFloatBit = 2;
     };
 
+    // Survival feedback for the objects allocated by an object literal. One in PretenureSampleInterval
+    // objects is checked at the next collection, and once enough of them survive, the site's objects
+    // are allocated into the recycler's pretenured heap blocks.
+    struct AllocationSiteInfo
+    {
+        Field(uint16) allocationsUntilSample;
+        Field(uint8) survivedSampleCount;
+        Field(uint8) diedSampleCount;
+
+        static const uint MinSampleCount = 4;
+        static const uint MaxSampleCount = 64;
+
+        bool IsPretenured() const
+        {
+            const uint sampleCount = survivedSampleCount + diedSampleCount;
+            return sampleCount >= MinSampleCount &&
+                survivedSampleCount * 100 >= sampleCount * (uint)CONFIG_FLAG(PretenureSurvivalPercent);
+        }
+    };
+
+    // An object sampled at an allocation site, waiting for a collection to find out whether it survives
+    struct AllocationSiteSample
+    {
+        static const uint MaxPending = 32;
+
+        Field(RecyclerWeakReference<RecyclableObject> *) object;
+        Field(DynamicProfileInfo *) profileInfo;
+        Field(uint) siteIndex;
+        Field(uint) collectionEpoch;
+    };
+
     class DynamicProfileInfo;
     typedef SListBase<DynamicProfileInfo*, Recycler> DynamicProfileInfoList;
 
@@ -345,8 +376,8 @@ namespace Js
 
         static Var EnsureDynamicProfileInfoThunk(RecyclableObject * function, CallInfo callInfo, ...);
 
-#ifdef DYNAMIC_PROFILE_STORAGE
         bool HasFunctionBody() const { return hasFunctionBody; }
+#ifdef DYNAMIC_PROFILE_STORAGE
         FunctionBody * GetFunctionBody() const { Assert(hasFunctionBody); return functionBody; }
 #endif
 
@@ -361,6 +392,11 @@ namespace Js
         ArrayCallSiteInfo *GetArrayCallSiteInfo(FunctionBody *functionBody, ProfileId index) const;
         ArrayCallSiteInfo *GetArrayCallSiteInfo() const { return arrayCallSiteInfo; }
 
+        bool IsAllocationSitePretenured(FunctionBody *functionBody, uint siteIndex) const;
+        AllocationSiteInfo *GetAllocationSiteInfo() const { return allocationSiteInfo; }
+        void RecordAllocationSite(FunctionBody *functionBody, uint siteIndex, RecyclableObject *object);
+        void RecordAllocationSiteSurvival(uint siteIndex, bool survived);
+
         void RecordFieldAccess(FunctionBody* functionBody, uint fieldAccessId, Var object, FldInfoFlags flags);
         void RecordPolymorphicFieldAccess(FunctionBody *functionBody, uint fieldAccessid);
         bool HasPolymorphicFldAccess() const { return bits.hasPolymorphicFldAccess; }
@@ -467,6 +503,7 @@ namespace Js
         Field(LdElemInfo *) ldElemInfo;
         Field(StElemInfo *) stElemInfo;
         Field(ArrayCallSiteInfo *) arrayCallSiteInfo;
+        Field(AllocationSiteInfo *) allocationSiteInfo;
         Field(ValueType *) parameterInfo;
         Field(FldInfo *) fldInfo;
         Field(ValueType *) slotInfo;
@@ -574,15 +611,15 @@ namespace Js
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         Field(FunctionBody *) functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
         // Used by de-serialize
         DynamicProfileInfo();
 
         template <typename T>
         static DynamicProfileInfo * Deserialize(T * reader, Recycler* allocator, Js::LocalFunctionId * functionId);
         template <typename T>
-        bool Serialize(T * writer);
+        bool Serialize(T * writer, FunctionBody * functionBody);
 
+#ifdef DYNAMIC_PROFILE_STORAGE
         static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
 #endif
         static Js::LocalFunctionId const CallSiteMixed = (Js::LocalFunctionId)-1;
@@ -601,6 +638,7 @@ namespace Js
         DynamicProfileInfo(FunctionBody * functionBody);
 
         friend class SourceDynamicProfileManager;
+        friend class DynamicProfileCache;
 
     public:
         bool IsAggressiveIntTypeSpecDisabled(const bool isJitLoopBody) const
@@ -854,7 +892,6 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
     class BufferReader
     {
     public:
@@ -914,7 +951,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info) {}
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody) {}
 #endif
 
         template <typename T>
@@ -946,7 +983,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info);
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody);
 #endif
         template <typename T>
         bool WriteArray(__in_ecount(len) T * data, size_t len)
@@ -972,6 +1009,5 @@ namespace Js
         char * current;
         size_t lengthLeft;
     };
-#endif
 };
 #endif
@@ -5543,28 +5543,45 @@ namespace Js
 
     void InterpreterStackFrame::OP_NewScObjectLiteral(const unaligned OpLayoutAuxiliary * playout )
     {
-        const Js::PropertyIdArray *propIds = Js::ByteCodeReader::ReadPropertyIdArray(playout->Offset, this->GetFunctionBody());
-
-        Var newObj = JavascriptOperators::NewScObjectLiteral(GetScriptContext(), propIds,
-            this->GetFunctionBody()->GetObjectLiteralTypeRef(playout->C1));
+        Var newObj = NewScObjectLiteral(playout);
 
         SetReg(playout->R0, newObj);
     }
 
     void InterpreterStackFrame::OP_NewScObjectLiteral_LS(const unaligned OpLayoutAuxiliary * playout, RegSlot& target)
     {
-        const Js::PropertyIdArray *propIds = Js::ByteCodeReader::ReadPropertyIdArray(playout->Offset, this->GetFunctionBody());
-
         target = playout->R0;
 
-        Var newObj = JavascriptOperators::NewScObjectLiteral(GetScriptContext(), propIds,
-            this->GetFunctionBody()->GetObjectLiteralTypeRef(playout->C1));
+        Var newObj = NewScObjectLiteral(playout);
 
         SetReg(playout->R0, newObj);
 
         target = Js::Constants::NoRegister;
     }
 
+    Var InterpreterStackFrame::NewScObjectLiteral(const unaligned OpLayoutAuxiliary * playout)
+    {
+        FunctionBody * functionBody = this->GetFunctionBody();
+        ScriptContext * scriptContext = GetScriptContext();
+        const Js::PropertyIdArray *propIds = Js::ByteCodeReader::ReadPropertyIdArray(playout->Offset, functionBody);
+        Field(DynamicType*)* literalType = functionBody->GetObjectLiteralTypeRef(playout->C1);
+
+#if ENABLE_PROFILE_INFO
+        // The literal index doubles as the allocation site: sample the objects it creates to see whether
+        // they outlive the next collection, and allocate them pretenured once most of them do.
+        if (functionBody->HasDynamicProfileInfo() && scriptContext->GetRecycler()->IsPretenuringEnabled())
+        {
+            DynamicProfileInfo * profileInfo = functionBody->GetAnyDynamicProfileInfo();
+            bool pretenure = profileInfo->IsAllocationSitePretenured(functionBody, playout->C1);
+            Var newObj = JavascriptOperators::NewScObjectLiteral(scriptContext, propIds, literalType, pretenure);
+            profileInfo->RecordAllocationSite(functionBody, playout->C1, RecyclableObject::UnsafeFromVar(newObj));
+            return newObj;
+        }
+#endif
+
+        return JavascriptOperators::NewScObjectLiteral(scriptContext, propIds, literalType);
+    }
+
     void InterpreterStackFrame::OP_LdPropIds(const unaligned OpLayoutAuxiliary * playout)
     {
         const Js::PropertyIdArray *propIds = Js::ByteCodeReader::ReadPropertyIdArray(playout->Offset, this->GetFunctionBody());
@@ -5342,7 +5342,7 @@ CommonNumber:
         return newType;
     }
 
-    Var JavascriptOperators::NewScObjectLiteral(ScriptContext* scriptContext, const Js::PropertyIdArray *propIds, Field(DynamicType*)* literalType)
+    Var JavascriptOperators::NewScObjectLiteral(ScriptContext* scriptContext, const Js::PropertyIdArray *propIds, Field(DynamicType*)* literalType, bool pretenure)
     {
         Assert(propIds->count != 0);
         Assert(!propIds->hadDuplicates);        // duplicates are removed by parser
@@ -5357,7 +5357,9 @@ CommonNumber:
 #endif
 
         DynamicType* newType = EnsureObjectLiteralType(scriptContext, propIds, literalType);
-        DynamicObject* instance = DynamicObject::New(scriptContext->GetRecycler(), newType);
+        DynamicObject* instance = pretenure ?
+            DynamicObject::NewPretenured(scriptContext->GetRecycler(), newType) :
+            DynamicObject::New(scriptContext->GetRecycler(), newType);
 
         if (!newType->GetIsShared())
         {
@@ -5376,6 +5378,11 @@ CommonNumber:
         return instance;
     }
 
+    Var JavascriptOperators::NewScObjectLiteralPretenured(ScriptContext* scriptContext, const Js::PropertyIdArray *propIds, Field(DynamicType*)* literalType)
+    {
+        return NewScObjectLiteral(scriptContext, propIds, literalType, /* pretenure = */ true);
+    }
+
     uint JavascriptOperators::GetLiteralSlotCapacity(Js::PropertyIdArray const * propIds)
     {
         const uint inlineSlotCapacity = GetLiteralInlineSlotCapacity(propIds);
@@ -458,7 +458,7 @@ namespace Js
                 continue;
             }
 
-            if (!dynamicProfileInfo->Serialize(writer))
+            if (!dynamicProfileInfo->Serialize(writer, dynamicProfileInfo->GetFunctionBody()))
             {
                 return false;
             }
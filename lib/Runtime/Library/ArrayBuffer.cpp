@@ -771,6 +771,11 @@ namespace Js
 #endif
     }
 
+    static void CALLBACK FreeBufferCallback(void * buffer)
+    {
+        free(buffer);
+    }
+
     void JavascriptArrayBuffer::Finalize(bool isShutdown)
     {
         // In debugger scenario, ScriptAuthor can create scriptContext and delete scriptContext
@@ -778,10 +783,13 @@ namespace Js
         // matching scriptContext might have been deleted and the javascriptLibrary->scriptContext
         // field reset (but javascriptLibrary is still alive).
         // Use the recycler field off library instead of scriptcontext to avoid av.
+        Recycler* recycler = GetType()->GetLibrary()->GetRecycler();
 
         // Recycler may not be available at Dispose. We need to
         // free the memory and report that it has been freed at the same
         // time. Otherwise, AllocationPolicyManager is unable to provide correct feedback
+        // Heap buffers may be freed by the recycler's background finalizer instead, which
+        // runs right after this sweep.
 #if ENABLE_FAST_ARRAYBUFFER
         //AsmJS Virtual Free
         if (buffer && IsValidVirtualBufferLength(this->bufferLength))
@@ -789,13 +797,11 @@ namespace Js
             FreeMemAlloc(buffer);
         }
         else
+#endif
+        if (buffer == nullptr || isShutdown || !recycler->QueueBackgroundFinalize(FreeBufferCallback, buffer))
         {
             free(buffer);
         }
-#else
-        free(buffer);
-#endif
-        Recycler* recycler = GetType()->GetLibrary()->GetRecycler();
         recycler->ReportExternalMemoryFree(bufferLength);
 
         buffer = nullptr;
@@ -6396,7 +6396,7 @@ namespace Js
     JavascriptWeakMap* JavascriptLibrary::CreateWeakMap()
     {
         AssertMsg(weakMapType, "Where's weakMapType?");
-        return RecyclerNewFinalized(this->GetRecycler(), JavascriptWeakMap, weakMapType);
+        return RecyclerNew(this->GetRecycler(), JavascriptWeakMap, weakMapType);
     }
 
     JavascriptWeakSet* JavascriptLibrary::CreateWeakSet()
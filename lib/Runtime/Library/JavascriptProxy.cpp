@@ -215,8 +215,7 @@ namespace Js
         //3. Let target be the value of the[[ProxyTarget]] internal slot of O.
         Js::RecyclableObject *targetObj = this->MarshalTarget(requestContext);
 
-        Assert((static_cast<DynamicType*>(GetType()))->GetTypeHandler()->GetPropertyCount() == 0 ||
-            (static_cast<DynamicType*>(GetType()))->GetTypeHandler()->GetPropertyId(GetScriptContext(), 0) == InternalPropertyIds::WeakMapKeyMap);
+        Assert((static_cast<DynamicType*>(GetType()))->GetTypeHandler()->GetPropertyCount() == 0);
         JavascriptFunction* gOPDMethod = GetMethodHelper(PropertyIds::getOwnPropertyDescriptor, requestContext);
 
         //7. If trap is undefined, then
@@ -569,10 +568,6 @@ namespace Js
 
     BOOL JavascriptProxy::GetInternalProperty(Var instance, PropertyId internalPropertyId, Var* value, PropertyValueInfo* info, ScriptContext* requestContext)
     {
-        if (internalPropertyId == InternalPropertyIds::WeakMapKeyMap)
-        {
-            return __super::GetInternalProperty(instance, internalPropertyId, value, info, requestContext);
-        }
         return FALSE;
     }
   
@@ -698,10 +693,6 @@ namespace Js
 
     BOOL JavascriptProxy::SetInternalProperty(PropertyId internalPropertyId, Var value, PropertyOperationFlags flags, PropertyValueInfo* info)
     {
-        if (internalPropertyId == InternalPropertyIds::WeakMapKeyMap)
-        {
-            return __super::SetInternalProperty(internalPropertyId, value, flags, info);
-        }
         return FALSE;
     }
 
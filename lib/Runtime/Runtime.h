@@ -490,6 +490,10 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #define CHAKRATEL_LANGSTATS_INC_LANGFEATURECOUNT(feature, m_scriptContext)
 #define CHAKRATEL_LANGSTATS_INC_DATACOUNT(feature)
 #endif
+#include "Base/AllocationSampleProfile.h"
+#include "Base/CacheFile.h"
+#include "Base/JitWarmupCache.h"
+#include "Language/DynamicProfileCache.h"
 #include "Base/ThreadContext.h"
 
 #include "Base/StackProber.h"
@@ -99,6 +99,17 @@ namespace Js
         return NewObject<DynamicObject>(recycler, type);
     }
 
+    DynamicObject * DynamicObject::NewPretenured(Recycler * recycler, DynamicType * type)
+    {
+#ifdef RECYCLER_STRESS
+        if (Js::Configuration::Global.flags.RecyclerTrackStress)
+        {
+            return NewObject<DynamicObject>(recycler, type);
+        }
+#endif
+        return RecyclerNewPretenuredPlusZ(recycler, type->GetTypeHandler()->GetInlineSlotsSize(), DynamicObject, type);
+    }
+
     bool DynamicObject::Is(Var aValue)
     {
         return RecyclableObject::Is(aValue) && (RecyclableObject::UnsafeFromVar(aValue)->GetTypeId() == TypeIds_Object);
@@ -686,13 +697,9 @@ namespace Js
         }
 
         // Marshalling cannot handle non-Var values, so extract
-        // the two internal property values that could appear on a CEO, clear them to null which
-        // marshalling does handle, and then restore them after marshalling.  Neither property's
-        // data needs marshalling because:
-        //  1. StackTrace's data does not contain references to JavaScript objects that would need marshalling.
-        //  2. Values in the WeakMapKeyMap can only be accessed by the WeakMap object that put them there.  If
-        //     that WeakMap is marshalled it will take care of any necessary marshalling of the value by virtue
-        //     of being wrapped in CrossSite<>.
+        // the internal property values that could appear on a CEO, clear them to null which
+        // marshalling does handle, and then restore them after marshalling.  StackTrace's data
+        // does not need marshalling as it does not contain references to JavaScript objects.
 
         Var stackTraceValue = nullptr;
         if (this->GetInternalProperty(this, InternalPropertyIds::StackTrace, &stackTraceValue, nullptr, this->GetScriptContext()))
@@ -705,16 +712,6 @@ namespace Js
             stackTraceValue = nullptr;
         }
 
-        Var weakMapKeyMapValue = nullptr;
-        if (this->GetInternalProperty(this, InternalPropertyIds::WeakMapKeyMap, &weakMapKeyMapValue, nullptr, this->GetScriptContext()))
-        {
-            this->SetInternalProperty(InternalPropertyIds::WeakMapKeyMap, nullptr, PropertyOperation_Force, nullptr);
-        }
-        else
-        {
-            weakMapKeyMapValue = nullptr;
-        }
-
         Var mutationBpValue = nullptr;
         if (this->GetInternalProperty(this, InternalPropertyIds::MutationBp, &mutationBpValue, nullptr, this->GetScriptContext()))
         {
@@ -740,10 +737,6 @@ namespace Js
             {
                 this->SetInternalProperty(InternalPropertyIds::StackTrace, stackTraceValue, PropertyOperation_None, nullptr);
             }
-            if (weakMapKeyMapValue)
-            {
-                this->SetInternalProperty(InternalPropertyIds::WeakMapKeyMap, weakMapKeyMapValue, PropertyOperation_Force, nullptr);
-            }
             if (mutationBpValue)
             {
                 this->SetInternalProperty(InternalPropertyIds::MutationBp, mutationBpValue, PropertyOperation_Force, nullptr);
@@ -128,6 +128,8 @@ namespace Js
 
     public:
         static DynamicObject * New(Recycler * recycler, DynamicType * type);
+        // For objects expected to be long-lived, see Recycler::AllocZeroPretenured
+        static DynamicObject * NewPretenured(Recycler * recycler, DynamicType * type);
 
         static bool Is(Var aValue);
         static DynamicObject* FromVar(Var value);
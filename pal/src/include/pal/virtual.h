@@ -69,6 +69,7 @@ enum VIRTUAL_CONSTANTS
     VIRTUAL_PAGE_SIZE       = 0x1000,
 #endif  // __sparc__
     VIRTUAL_PAGE_MASK       = VIRTUAL_PAGE_SIZE - 1,
+    VIRTUAL_HUGE_PAGE_SIZE  = 0x200000, /* Alignment of MEM_RESERVE_HUGEPAGES */
     BOUNDARY_64K    = 0xffff
 };
 
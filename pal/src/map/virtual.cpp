@@ -864,6 +864,104 @@ done:
     return bRetVal;
 }
 
+/******
+ *
+ *  VIRTUALResetMemory() - Helper function that implements MEM_RESET.
+ *
+ *      The pages stay committed, but the kernel is free to reclaim them
+ *      whenever it needs to. Their content is undefined until written again.
+ *
+ */
+static LPVOID VIRTUALResetMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN LPVOID lpAddress,        /* Region to reset */
+                IN SIZE_T dwSize)           /* Size of Region */
+{
+    UINT_PTR StartBoundary;
+    SIZE_T MemSize;
+
+    if ( lpAddress == NULL || dwSize == 0 )
+    {
+        ERROR( "MEM_RESET needs a committed region.\n" );
+        pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+        return NULL;
+    }
+
+    StartBoundary = (UINT_PTR)lpAddress & ~VIRTUAL_PAGE_MASK;
+    MemSize = ( ((UINT_PTR)lpAddress + dwSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+               StartBoundary;
+
+    TRACE( "Resetting the following page(s) %p, size %u.\n", StartBoundary, MemSize );
+
+#ifdef MADV_FREE
+    // MADV_FREE lets the kernel take the pages lazily, only under memory pressure.
+    // Older kernels reject it, in which case fall back to dropping them right away.
+    if ( madvise( (LPVOID)StartBoundary, MemSize, MADV_FREE ) == 0 )
+    {
+        return lpAddress;
+    }
+#endif
+    if ( madvise( (LPVOID)StartBoundary, MemSize, MADV_DONTNEED ) == 0 )
+    {
+        return lpAddress;
+    }
+
+    ERROR( "madvise failed to reset the region, errno %d.\n", errno );
+    pthrCurrent->SetLastError( ERROR_INVALID_ADDRESS );
+    return NULL;
+}
+
+#if !MMAP_IGNORES_HINT && !HAVE_VM_ALLOCATE && !RESERVE_FROM_BACKING_FILE
+/******
+ *
+ *  VIRTUALReserveHugePageMemory() - Helper function that reserves memory
+ *  aligned to the huge page size for MEM_RESERVE_HUGEPAGES.
+ *
+ *      The advice is kept with the mapping, and the mapping is replaced when
+ *      pages get committed, so VIRTUALCommitMemory advises them again.
+ *
+ */
+static LPVOID VIRTUALReserveHugePageMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T dwSize)           /* Size of Region, page aligned */
+{
+    // Over-reserve so that an aligned range of the requested size fits,
+    // then hand back what is on either side of it.
+    SIZE_T reserveSize = dwSize + VIRTUAL_HUGE_PAGE_SIZE;
+    if (reserveSize < dwSize)
+    {
+        pthrCurrent->SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+        return NULL;
+    }
+
+    char * reserved = (char *)mmap(NULL, reserveSize, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+    if (reserved == MAP_FAILED)
+    {
+        ERROR( "Failed due to insufficient memory.\n" );
+        pthrCurrent->SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+        return NULL;
+    }
+
+    char * aligned = (char *)(((UINT_PTR)reserved + VIRTUAL_HUGE_PAGE_SIZE - 1) & ~(UINT_PTR)(VIRTUAL_HUGE_PAGE_SIZE - 1));
+    char * alignedEnd = aligned + dwSize;
+    char * reservedEnd = reserved + reserveSize;
+    if (aligned != reserved)
+    {
+        munmap(reserved, aligned - reserved);
+    }
+    if (alignedEnd != reservedEnd)
+    {
+        munmap(alignedEnd, reservedEnd - alignedEnd);
+    }
+
+#ifdef MADV_HUGEPAGE
+    // Only advice: THP may be disabled, in which case this is just an aligned reservation
+    madvise(aligned, dwSize, MADV_HUGEPAGE);
+#endif
+    return aligned;
+}
+#endif // !MMAP_IGNORES_HINT && !HAVE_VM_ALLOCATE && !RESERVE_FROM_BACKING_FILE
+
 /******
  *
  *  VIRTUALReserveMemory() - Helper function that actually reserves the memory.
@@ -903,8 +1001,17 @@ static LPVOID VIRTUALReserveMemory(
 
     if (pRetVal == NULL)
     {
-        // Try to reserve memory from the OS
-        pRetVal = ReserveVirtualMemory(pthrCurrent, (LPVOID)StartBoundary, MemSize);
+#if !MMAP_IGNORES_HINT && !HAVE_VM_ALLOCATE && !RESERVE_FROM_BACKING_FILE
+        if ( (flAllocationType & MEM_RESERVE_HUGEPAGES) != 0 && lpAddress == NULL )
+        {
+            pRetVal = VIRTUALReserveHugePageMemory(pthrCurrent, MemSize);
+        }
+        else
+#endif
+        {
+            // Try to reserve memory from the OS
+            pRetVal = ReserveVirtualMemory(pthrCurrent, (LPVOID)StartBoundary, MemSize);
+        }
     }
 
     if (pRetVal != NULL)
@@ -1175,6 +1282,13 @@ static LPVOID VIRTUALCommitMemory(
 #endif // MMAP_DOESNOT_ALLOW_REMAP
             if (pRet != MAP_FAILED)
             {
+#if defined(MADV_HUGEPAGE) && !MMAP_DOESNOT_ALLOW_REMAP
+                if ((pInformation->allocationType & MEM_RESERVE_HUGEPAGES) != 0)
+                {
+                    // The new mapping doesn't carry the advice of the reservation
+                    madvise((void *) StartBoundary, MemSize, MADV_HUGEPAGE);
+                }
+#endif
 #if MMAP_DOESNOT_ALLOW_REMAP
                 SIZE_T i;
                 char *temp = (char *) StartBoundary;
@@ -1600,6 +1714,7 @@ Function:
 Note:
   MEM_TOP_DOWN, MEM_PHYSICAL, MEM_WRITE_WATCH are not supported.
   Unsupported flags are ignored.
+  MEM_RESET is supported on its own, through madvise.
 
   Page size on i386 is set to 4k.
 
@@ -1633,11 +1748,17 @@ VirtualAlloc_(
         goto done;
     }
 
+    if ( flAllocationType == MEM_RESET )
+    {
+        pRetVal = VIRTUALResetMemory( pthrCurrent, lpAddress, dwSize );
+        goto done;
+    }
+
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE | MEM_RESERVE_HUGEPAGES ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, or MEM_RESERVE_EXECUTABLE.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE or MEM_RESERVE_HUGEPAGES.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -0,0 +1,53 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Arena block cache across script entries. Parsing and compiling fill the thread's arena block cache,
+// and leaving script, which leaves idle decommit, gives the cached blocks back as free pages. Each
+// timeout callback below is its own script entry, so the cache is filled and released over and over,
+// and the next compiles must get working arena blocks whether they come from the cache or not.
+
+// A function whose parse and byte code generation need a good number of arena blocks
+function makeSource(id, statementCount) {
+    var source = "var sum = 0;\n";
+    for (var i = 0; i < statementCount; i++) {
+        source += "var v" + i + " = { id: " + (id + i) + ", next: x + " + i + " }; sum += v" + i + ".next - v" + i + ".id;\n";
+    }
+    return source + "return sum;";
+}
+
+function expected(id, statementCount) {
+    var sum = 0;
+    for (var i = 0; i < statementCount; i++) {
+        sum += i - (id + i);
+    }
+    return sum + statementCount * 100;
+}
+
+var entryCount = 40;
+var failures = 0;
+
+function runEntry(entry) {
+    var statementCount = 50 + (entry * 37) % 400;
+    var f = new Function("x", makeSource(entry, statementCount));
+    if (f(100) !== expected(entry, statementCount)) {
+        WScript.Echo("FAILED: function " + entry + " returned " + f(100));
+        failures++;
+    }
+
+    // Regular expressions are compiled in arenas too
+    var pattern = new RegExp("(a|b" + entry + ")+c{1," + (entry + 1) + "}$");
+    if (!pattern.test("abb" + entry + "c") || pattern.test("ab")) {
+        WScript.Echo("FAILED: pattern " + entry);
+        failures++;
+    }
+
+    if (entry + 1 < entryCount) {
+        WScript.SetTimeout(function () { runEntry(entry + 1); }, 0);
+    } else {
+        WScript.Echo(failures === 0 ? "pass" : "fail");
+    }
+}
+
+WScript.SetTimeout(function () { runEntry(0); }, 0);
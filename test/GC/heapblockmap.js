@@ -0,0 +1,58 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Heap block map lookups. Marking looks up every candidate pointer, including the ones found by scanning
+// the stack conservatively, in the heap block map. On 64-bit the lookup first tests the node filter, so
+// every heap segment, small or large, must be found through it, including segments mapped after earlier
+// ones were released and their map nodes cleaned up.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeGraph(count, largeEvery) {
+    var nodes = [];
+    for (var i = 0; i < count; i++) {
+        var node = { i: i, prev: nodes[i - 1] || null };
+        if (i % largeEvery === 0) {
+            node.large = new Array(10000);
+            node.large[9999] = i;
+        }
+        nodes.push(node);
+    }
+    return nodes[count - 1];
+}
+
+function checkGraph(last, count, largeEvery) {
+    var node = last;
+    for (var i = count - 1; i >= 0; i--) {
+        if (node === null || node.i !== i) {
+            return false;
+        }
+        if (i % largeEvery === 0 && node.large[9999] !== i) {
+            return false;
+        }
+        node = node.prev;
+    }
+    return node === null;
+}
+
+var tests = [
+    {
+        name: "Objects in small and large heap blocks stay reachable across collections",
+        body: function () {
+            for (var round = 0; round < 5; round++) {
+                // Only reachable through a local, so it has to be found by the stack scan
+                var last = makeGraph(4000, 100);
+                CollectGarbage();
+                assert.isTrue(checkGraph(last, 4000, 100), "graph of round " + round + " is intact");
+
+                // Release everything so the empty segments can go and new ones be mapped next round
+                last = null;
+                CollectGarbage();
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,49 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Leaf heap block density ordering. Survivors are left at different densities in the leaf blocks, so the
+// blocks are reordered by density after each sweep and new allocations fill the densest ones first. The
+// survivors must be intact whichever blocks the new strings are put in.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeString(id) {
+    return "s" + id + "-".repeat(id % 40);
+}
+
+var tests = [
+    {
+        name: "Leaf objects survive in sparse and dense blocks",
+        body: function () {
+            var live = [];
+            var nextId = 0;
+            for (var round = 0; round < 10; round++) {
+                for (var i = 0; i < 3000; i++) {
+                    live.push({ id: nextId, text: makeString(nextId) });
+                    nextId++;
+                }
+
+                // Keep every entry of some runs and few of others, so blocks end up at different densities
+                var survivors = [];
+                for (var j = 0; j < live.length; j++) {
+                    var keepAll = ((j >> 6) % 3) === 0;
+                    if (keepAll || j % 16 === 0) {
+                        survivors.push(live[j]);
+                    }
+                }
+                live = survivors;
+                CollectGarbage();
+
+                for (var k = 0; k < live.length; k++) {
+                    if (live[k].text !== makeString(live[k].id)) {
+                        assert.fail("string " + live[k].id + " is intact");
+                    }
+                }
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Page segment cache. Each phase fills a different kind of heap block (leaf, normal, large), then drops
+// all of it and collects, so the empty segments are released into the process wide cache and handed to
+// whichever page allocator grows next. A reused segment must look like freshly committed memory.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function fillLeaf(count) {
+    var strings = [];
+    for (var i = 0; i < count; i++) {
+        strings.push("leaf" + i + "_".repeat(i % 200));
+    }
+    return strings;
+}
+
+function fillNormal(count) {
+    var objects = [];
+    for (var i = 0; i < count; i++) {
+        objects.push({ i: i, next: objects[i - 1] || null, values: [i, i * 2] });
+    }
+    return objects;
+}
+
+function fillLarge(count) {
+    var arrays = [];
+    for (var i = 0; i < count; i++) {
+        var a = new Array(20000 + i);
+        a[0] = i;
+        a[a.length - 1] = -i;
+        arrays.push(a);
+    }
+    return arrays;
+}
+
+var tests = [
+    {
+        name: "Segments released by one kind of heap block are reused by another",
+        body: function () {
+            for (var round = 0; round < 4; round++) {
+                var strings = fillLeaf(3000);
+                strings = null;
+                CollectGarbage();
+
+                var objects = fillNormal(3000);
+                for (var i = 0; i < objects.length; i++) {
+                    var o = objects[i];
+                    if (o.i !== i || o.values[1] !== i * 2 || (i > 0 && o.next !== objects[i - 1])) {
+                        assert.fail("object " + i + " of round " + round + " is intact");
+                    }
+                }
+                objects = null;
+                CollectGarbage();
+
+                var arrays = fillLarge(8);
+                for (var i = 0; i < arrays.length; i++) {
+                    var a = arrays[i];
+                    assert.areEqual(i, a[0], "first element");
+                    assert.areEqual(-i, a[a.length - 1], "last element");
+                    // Memory from a reused segment must read as never written
+                    assert.areEqual(undefined, a[1], "unset element");
+                    assert.areEqual(undefined, a[a.length - 2], "unset element");
+                }
+                arrays = null;
+                CollectGarbage();
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,117 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Parallel mark with work stealing. The graphs are built so that the mark work is split unevenly: a few
+// roots reach most of the objects, so the mark contexts that drain their own stacks steal chunks from the
+// others. Every object must still be marked, whichever context ends up marking it.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Builds a tree of the given fan out and depth, where every node records the path to it
+function makeTree(fanOut, depth, id) {
+    var node = { id: id, children: [] };
+    if (depth > 0) {
+        for (var i = 0; i < fanOut; i++) {
+            node.children.push(makeTree(fanOut, depth - 1, id * fanOut + i + 1));
+        }
+    }
+    return node;
+}
+
+function countTree(node, fanOut) {
+    var count = 1;
+    for (var i = 0; i < node.children.length; i++) {
+        if (node.children[i].id !== node.id * fanOut + i + 1) {
+            return -1;
+        }
+        var childCount = countTree(node.children[i], fanOut);
+        if (childCount < 0) {
+            return -1;
+        }
+        count += childCount;
+    }
+    return count;
+}
+
+function makeList(length) {
+    var head = null;
+    for (var i = 0; i < length; i++) {
+        head = { value: length - 1 - i, next: head, payload: [i, i + 1] };
+    }
+    return head;
+}
+
+function checkList(head, length) {
+    var i = 0;
+    for (var node = head; node !== null; node = node.next) {
+        if (node.value !== i || node.payload[0] !== length - 1 - i) {
+            return false;
+        }
+        i++;
+    }
+    return i === length;
+}
+
+var tests = [
+    {
+        name: "Wide trees survive parallel mark",
+        body: function () {
+            // 4 + 16 + ... + 4^8 nodes under each root
+            var roots = [];
+            for (var i = 0; i < 4; i++) {
+                roots.push(makeTree(4, 8, 0));
+            }
+
+            for (var collection = 0; collection < 4; collection++) {
+                CollectGarbage();
+                for (var i = 0; i < roots.length; i++) {
+                    assert.areEqual(87381, countTree(roots[i], 4), "tree " + i + " is intact after collection " + collection);
+                }
+            }
+        }
+    },
+    {
+        name: "Many small roots next to a few large ones survive parallel mark",
+        body: function () {
+            var roots = [];
+            for (var i = 0; i < 20000; i++) {
+                roots.push({ index: i, data: [i] });
+            }
+            var big = [makeTree(8, 5, 0), makeList(50000)];
+
+            for (var collection = 0; collection < 4; collection++) {
+                // Churn the small roots between collections so that the split differs each time
+                for (var i = collection; i < roots.length; i += 4) {
+                    roots[i] = { index: i, data: [i] };
+                }
+                CollectGarbage();
+
+                var broken = -1;
+                for (var i = 0; i < roots.length; i++) {
+                    if (roots[i].index !== i || roots[i].data[0] !== i) {
+                        broken = i;
+                        break;
+                    }
+                }
+                assert.areEqual(-1, broken, "the small roots are intact after collection " + collection);
+                assert.areEqual(37449, countTree(big[0], 8), "the tree is intact after collection " + collection);
+                assert.isTrue(checkList(big[1], 50000), "the list is intact after collection " + collection);
+            }
+        }
+    },
+    {
+        name: "A long list, which can't be split, survives parallel mark",
+        body: function () {
+            var lists = [makeList(200000), makeList(1000)];
+            for (var collection = 0; collection < 3; collection++) {
+                CollectGarbage();
+                assert.isTrue(checkList(lists[0], 200000), "the long list is intact after collection " + collection);
+                assert.isTrue(checkList(lists[1], 1000), "the short list is intact after collection " + collection);
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Parallel sweep. The objects are spread over many small and medium size buckets, normal and leaf, and
+// about half of them die between collections, so the parallel mark threads have buckets to claim during
+// the background sweep. The survivors must be intact, and the freed slots must be reusable afterwards.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// An object whose allocation size depends on the number of its properties
+function makeObject(id, propertyCount) {
+    var o = { id: id };
+    for (var i = 0; i < propertyCount; i++) {
+        o["p" + i] = id + i;
+    }
+    return o;
+}
+
+function checkObject(o, id, propertyCount) {
+    if (o.id !== id) {
+        return false;
+    }
+    for (var i = 0; i < propertyCount; i++) {
+        if (o["p" + i] !== id + i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Leaf allocations of various sizes
+function makeString(id, length) {
+    return (id + ":" + "x".repeat(length)).substring(0, length + 2);
+}
+
+var tests = [
+    {
+        name: "Survivors in many buckets are intact after each collection",
+        body: function () {
+            var live = [];
+            var nextId = 0;
+            for (var round = 0; round < 8; round++) {
+                for (var i = 0; i < 20000; i++) {
+                    var id = nextId++;
+                    var propertyCount = id % 24;
+                    live.push({ id: id, propertyCount: propertyCount, object: makeObject(id, propertyCount), text: makeString(id, id % 300) });
+                }
+
+                // Drop every other entry, so most heap blocks end up partly free
+                var survivors = [];
+                for (var j = round & 1; j < live.length; j += 2) {
+                    survivors.push(live[j]);
+                }
+                live = survivors;
+                CollectGarbage();
+
+                for (var k = 0; k < live.length; k++) {
+                    var entry = live[k];
+                    assert.isTrue(checkObject(entry.object, entry.id, entry.propertyCount), "object " + entry.id + " is intact");
+                    assert.areEqual(makeString(entry.id, entry.id % 300), entry.text, "string " + entry.id + " is intact");
+                }
+            }
+        }
+    },
+    {
+        name: "Allocations reuse the swept slots",
+        body: function () {
+            var arrays = [];
+            for (var round = 0; round < 20; round++) {
+                var batch = [];
+                for (var i = 0; i < 5000; i++) {
+                    var a = new Array(i % 64);
+                    for (var j = 0; j < a.length; j++) {
+                        a[j] = round * 100000 + i + j;
+                    }
+                    batch.push(a);
+                }
+                // Keep one batch in four
+                if (round % 4 === 0) {
+                    arrays.push({ round: round, batch: batch });
+                }
+            }
+            CollectGarbage();
+
+            assert.areEqual(5, arrays.length, "kept batches");
+            for (var k = 0; k < arrays.length; k++) {
+                var kept = arrays[k];
+                for (var i = 0; i < kept.batch.length; i++) {
+                    var a = kept.batch[i];
+                    assert.areEqual(i % 64, a.length, "array length");
+                    for (var j = 0; j < a.length; j++) {
+                        if (a[j] !== kept.round * 100000 + i + j) {
+                            assert.fail("array " + i + " of round " + kept.round + " is intact");
+                        }
+                    }
+                }
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
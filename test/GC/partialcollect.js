@@ -0,0 +1,79 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Partial collections. Objects that survived earlier collections are only rescanned when the pages
+// they're on were written to, through write watch or the software write barrier cards. Once a partial
+// collection has rescanned them the dirty pages are reset, so every old to young store made after that
+// must dirty its page again, or the young object it points to would be freed while still reachable.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeYoung(round, i) {
+    return { round: round, i: i, data: [round, i, round + i] };
+}
+
+function isYoungIntact(young, round, i) {
+    return young !== undefined && young.round === round && young.i === i &&
+        young.data.length === 3 && young.data[0] === round && young.data[1] === i && young.data[2] === round + i;
+}
+
+var tests = [
+    {
+        name: "Young objects stored into old objects survive the following partial collections",
+        body: function () {
+            var old = [];
+            for (var i = 0; i < 2000; i++) {
+                old.push({ slot: null });
+            }
+            CollectGarbage();
+
+            for (var round = 0; round < 30; round++) {
+                // Store into a different subset of the old objects each round, so the pages that were dirtied
+                // and reset in the previous rounds are written to again
+                for (var i = round % 3; i < old.length; i += 3) {
+                    old[i].slot = makeYoung(round, i);
+                }
+
+                // Garbage that keeps the partial collections coming
+                for (var j = 0; j < 2000; j++) {
+                    makeYoung(-1, j);
+                }
+
+                for (var i = round % 3; i < old.length; i += 3) {
+                    if (!isYoungIntact(old[i].slot, round, i)) {
+                        assert.fail("object stored in round " + round + " at " + i + " is intact");
+                    }
+                }
+            }
+        }
+    },
+    {
+        name: "Young objects stored into an old array survive the following partial collections",
+        body: function () {
+            var old = new Array(5000);
+            for (var i = 0; i < old.length; i++) {
+                old[i] = null;
+            }
+            CollectGarbage();
+
+            for (var round = 0; round < 20; round++) {
+                var stride = 1 + round % 7;
+                for (var i = 0; i < old.length; i += stride) {
+                    old[i] = makeYoung(round, i);
+                }
+                for (var j = 0; j < 2000; j++) {
+                    makeYoung(-1, j);
+                }
+                for (var i = 0; i < old.length; i += stride) {
+                    if (!isYoungIntact(old[i], round, i)) {
+                        assert.fail("element stored in round " + round + " at " + i + " is intact");
+                    }
+                }
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
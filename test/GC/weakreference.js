@@ -0,0 +1,96 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Weak references created and dropped while concurrent collections run. Script doesn't see the recycler
+// weak references directly, but property names that were never used before, typed array views on an
+// array buffer and type transitions all keep one. The ones script drops must go away, the ones it keeps
+// must still find what they point to, whichever collection found the sweep candidates.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var tests = [
+    {
+        name: "Property names created and dropped during collections",
+        body: function () {
+            var kept = {};
+            for (var round = 0; round < 10; round++) {
+                for (var i = 0; i < 5000; i++) {
+                    // Every name is new, so each one gets a weakly held property record
+                    var name = "name_" + round + "_" + i;
+                    var o = {};
+                    o[name] = i;
+                    if (i % 100 === 0) {
+                        kept[name] = o;
+                    }
+                }
+                CollectGarbage();
+            }
+
+            var count = 0;
+            for (var name in kept) {
+                var index = +name.split("_")[2];
+                assert.areEqual(index, kept[name][name], "property " + name + " is still found");
+                count++;
+            }
+            assert.areEqual(10 * 50, count, "kept objects");
+        }
+    },
+    {
+        name: "Typed array views created and dropped during collections",
+        body: function () {
+            var buffers = [];
+            for (var round = 0; round < 20; round++) {
+                var buffer = new ArrayBuffer(256);
+                var keptView = new Uint8Array(buffer, round, 1);
+                keptView[0] = round;
+                for (var i = 0; i < 2000; i++) {
+                    // Each view is a weakly referenced parent of the buffer
+                    new Int32Array(buffer, (i % 8) * 4, 8)[0] = i;
+                }
+                buffers.push({ round: round, buffer: buffer, view: keptView });
+                if (round % 4 === 0) {
+                    CollectGarbage();
+                }
+            }
+            CollectGarbage();
+
+            for (var k = 0; k < buffers.length; k++) {
+                var entry = buffers[k];
+                assert.areEqual(entry.round, entry.view[0], "view " + k + " is intact");
+                assert.areEqual(entry.round, new Uint8Array(entry.buffer)[entry.round], "buffer " + k + " is intact");
+            }
+        }
+    },
+    {
+        name: "Type transitions and weak map entries created and dropped during collections",
+        body: function () {
+            var map = new WeakMap();
+            var keys = [];
+            for (var round = 0; round < 10; round++) {
+                for (var i = 0; i < 3000; i++) {
+                    // A new shape per round and property count, each cached weakly on its predecessor
+                    var key = {};
+                    for (var p = 0; p < i % 16; p++) {
+                        key["r" + round + "p" + p] = p;
+                    }
+                    map.set(key, { round: round, index: i });
+                    if (i % 50 === 0) {
+                        keys.push(key);
+                    }
+                }
+                CollectGarbage();
+            }
+
+            assert.areEqual(10 * 60, keys.length, "kept keys");
+            for (var k = 0; k < keys.length; k++) {
+                var value = map.get(keys[k]);
+                assert.isTrue(value !== undefined, "weak map entry " + k + " is still there");
+                assert.areEqual(k % 60 * 50, value.index, "weak map entry " + k + " is intact");
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,118 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Object literals whose objects survive collections are allocated pretenured. The first calls run in the
+// profiling interpreter, which samples the literal and then pretenures it; with a low enough
+// -maxInterpretCount the later calls run jitted code that allocates through the pretenuring helper.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeRecord(i, payload) {
+    return { id: i, name: "record" + i, payload: payload, next: null };
+}
+
+function makeTemporary(i) {
+    return { value: i };
+}
+
+// Allocates count records, all kept alive and linked to the previous one, with short-lived objects
+// in between. Collects every collectInterval records so that the samples are resolved.
+function allocateRecords(records, count, collectInterval) {
+    for (var i = 0; i < count; i++) {
+        var id = records.length;
+        var record = makeRecord(id, makeTemporary(id));
+        record.next = id > 0 ? records[id - 1] : null;
+        records.push(record);
+
+        for (var j = 0; j < 4; j++) {
+            makeTemporary(j);
+        }
+
+        if (i % collectInterval === collectInterval - 1) {
+            CollectGarbage();
+        }
+    }
+}
+
+function checkRecords(records) {
+    for (var i = 0; i < records.length; i++) {
+        var record = records[i];
+        if (record === undefined) {
+            continue;
+        }
+        if (record.id !== i || record.name !== "record" + i || record.payload.value !== i) {
+            return i;
+        }
+        if (i > 0 && record.next !== records[i - 1] && records[i - 1] !== undefined) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+var tests = [
+    {
+        name: "Objects of a pretenured literal keep their properties across collections",
+        body: function () {
+            var records = [];
+            allocateRecords(records, 150, 10);
+            allocateRecords(records, 2000, 250);
+
+            CollectGarbage();
+            CollectGarbage();
+
+            assert.areEqual(2150, records.length, "all the records were allocated");
+            assert.areEqual(-1, checkRecords(records), "every record still has its properties and links");
+        }
+    },
+    {
+        name: "Objects of a pretenured literal can die and their blocks be reused",
+        body: function () {
+            var records = [];
+            allocateRecords(records, 150, 10);
+            allocateRecords(records, 1000, 250);
+
+            // Drop most of the records; the ones that are left still reference their payloads
+            for (var i = 0; i < records.length; i++) {
+                if (i % 8 !== 0) {
+                    records[i] = undefined;
+                }
+            }
+            CollectGarbage();
+            CollectGarbage();
+
+            allocateRecords(records, 1000, 250);
+            CollectGarbage();
+
+            assert.areEqual(-1, checkRecords(records), "the remaining records still have their properties");
+        }
+    },
+    {
+        name: "A pretenured object keeps the short-lived objects it references alive",
+        body: function () {
+            var records = [];
+            allocateRecords(records, 150, 10);
+
+            var keep = makeRecord(-1, null);
+            for (var i = 0; i < 100; i++) {
+                var temporary = makeTemporary(i);
+                temporary.link = keep.payload;
+                keep.payload = temporary;
+            }
+
+            CollectGarbage();
+            CollectGarbage();
+
+            var count = 0;
+            for (var payload = keep.payload; payload !== null; payload = payload.link) {
+                assert.areEqual(99 - count, payload.value, "the payload chain is intact");
+                count++;
+            }
+            assert.areEqual(100, count, "the whole payload chain survived");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,31 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// An object literal whose objects all survive is pretenured once enough of them have been sampled.
+// -testtrace:Pretenure prints the site when it is, so the baseline fails if it never is. This is the
+// only object literal in the test, so it is the only site the trace can print.
+
+function makeNode(i, next) {
+    return { id: i, next: next };
+}
+
+var head = null;
+for (var i = 0; i < 200; i++) {
+    head = makeNode(i, head);
+    if (i % 10 === 9) {
+        CollectGarbage();
+    }
+}
+
+var count = 0;
+for (var node = head; node !== null; node = node.next) {
+    if (node.id !== 199 - count) {
+        WScript.Echo("FAILED: node " + count + " has id " + node.id);
+        break;
+    }
+    count++;
+}
+
+WScript.Echo(count === 200 ? "pass" : "fail");
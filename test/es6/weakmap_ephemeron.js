@@ -0,0 +1,113 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// WeakMap GC semantics -- values whose keys are only reachable through other WeakMap values
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeChain(weakmaps, length) {
+    // The first key is returned; every other key is only reachable through the value of the previous entry
+    var firstKey = {};
+    var key = firstKey;
+    for (var i = 0; i < length; i++) {
+        var nextKey = { index: i + 1 };
+        weakmaps[i % weakmaps.length].set(key, { index: i, next: nextKey });
+        key = nextKey;
+    }
+    return firstKey;
+}
+
+function walkChain(weakmaps, firstKey, length) {
+    var key = firstKey;
+    for (var i = 0; i < length; i++) {
+        var value = weakmaps[i % weakmaps.length].get(key);
+        if (value === undefined || value.index !== i) {
+            return i;
+        }
+        key = value.next;
+    }
+    return length;
+}
+
+var tests = [
+    {
+        name: "Key reachable only through the value of another WeakMap survives a collection",
+        body: function () {
+            var outer = new WeakMap();
+            var inner = new WeakMap();
+            var root = {};
+
+            (function () {
+                var hiddenKey = {};
+                outer.set(root, { hiddenKey: hiddenKey });
+                inner.set(hiddenKey, { payload: "inner value" });
+            })();
+
+            CollectGarbage();
+
+            var hiddenKey = outer.get(root).hiddenKey;
+            assert.isTrue(inner.has(hiddenKey), "inner entry is kept alive through the outer WeakMap's value");
+            assert.areEqual("inner value", inner.get(hiddenKey).payload, "inner value survives the collection");
+        }
+    },
+    {
+        name: "Deep chains across several WeakMaps survive collections",
+        body: function () {
+            var weakmaps = [new WeakMap(), new WeakMap(), new WeakMap()];
+            var length = 1000;
+            var firstKey = makeChain(weakmaps, length);
+
+            CollectGarbage();
+            CollectGarbage();
+
+            assert.areEqual(length, walkChain(weakmaps, firstKey, length), "every link of the chain survives");
+        }
+    },
+    {
+        name: "Deep chain in a single WeakMap survives collections",
+        body: function () {
+            var weakmaps = [new WeakMap()];
+            var length = 1000;
+            var firstKey = makeChain(weakmaps, length);
+
+            CollectGarbage();
+
+            assert.areEqual(length, walkChain(weakmaps, firstKey, length), "every link of the chain survives");
+        }
+    },
+    {
+        name: "Entries whose WeakMap is only reachable through another WeakMap value survive a collection",
+        body: function () {
+            var outer = new WeakMap();
+            var root = {};
+            var key = {};
+
+            (function () {
+                var inner = new WeakMap();
+                inner.set(key, "inner value");
+                outer.set(root, inner);
+            })();
+
+            CollectGarbage();
+
+            assert.areEqual("inner value", outer.get(root).get(key), "the inner WeakMap and its entry survive");
+        }
+    },
+    {
+        name: "Dropping the first key of a chain lets the rest be collected",
+        body: function () {
+            var weakmaps = [new WeakMap(), new WeakMap()];
+            var keepKey = makeChain(weakmaps, 100);
+            makeChain(weakmaps, 100);
+
+            CollectGarbage();
+            CollectGarbage();
+
+            assert.areEqual(100, walkChain(weakmaps, keepKey, 100), "the chain that is still rooted survives");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
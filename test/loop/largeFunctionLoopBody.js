@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with a MaxJITFunctionBytecodeByteLength the function is over but its loops aren't: the function stays in the
+// interpreter and each of its loops is JIT'ed once.
+function big(n) {
+    var x = n;
+    x = (x * 31 + 1) % 65521;
+    x = (x * 31 + 2) % 65521;
+    x = (x * 31 + 3) % 65521;
+    x = (x * 31 + 4) % 65521;
+    x = (x * 31 + 5) % 65521;
+    x = (x * 31 + 6) % 65521;
+    x = (x * 31 + 7) % 65521;
+    x = (x * 31 + 8) % 65521;
+    x = (x * 31 + 9) % 65521;
+    x = (x * 31 + 10) % 65521;
+    x = (x * 31 + 11) % 65521;
+    x = (x * 31 + 12) % 65521;
+    x = (x * 31 + 13) % 65521;
+    x = (x * 31 + 14) % 65521;
+    x = (x * 31 + 15) % 65521;
+    x = (x * 31 + 16) % 65521;
+    x = (x * 31 + 17) % 65521;
+    x = (x * 31 + 18) % 65521;
+    x = (x * 31 + 19) % 65521;
+    x = (x * 31 + 20) % 65521;
+    x = (x * 31 + 21) % 65521;
+    x = (x * 31 + 22) % 65521;
+    x = (x * 31 + 23) % 65521;
+    x = (x * 31 + 24) % 65521;
+    x = (x * 31 + 25) % 65521;
+    x = (x * 31 + 26) % 65521;
+    x = (x * 31 + 27) % 65521;
+    x = (x * 31 + 28) % 65521;
+    x = (x * 31 + 29) % 65521;
+    x = (x * 31 + 30) % 65521;
+    x = (x * 31 + 31) % 65521;
+    x = (x * 31 + 32) % 65521;
+    x = (x * 31 + 33) % 65521;
+    x = (x * 31 + 34) % 65521;
+    x = (x * 31 + 35) % 65521;
+    x = (x * 31 + 36) % 65521;
+    x = (x * 31 + 37) % 65521;
+    x = (x * 31 + 38) % 65521;
+    x = (x * 31 + 39) % 65521;
+    x = (x * 31 + 40) % 65521;
+
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += i;
+    }
+    for (var j = 0; j < n; j++) {
+        sum -= j & 1;
+    }
+    return x >= 0 ? sum : -1;
+}
+
+WScript.Echo(big(1000));
+WScript.Echo(big(1000));
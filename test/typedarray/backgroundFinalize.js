@@ -0,0 +1,39 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// ArrayBuffers that die are freed by the background finalizer. Keep some alive across
+// collections and check that their contents aren't touched by the batches freeing the others.
+
+var live = [];
+for (var round = 0; round < 20; round++)
+{
+    for (var i = 0; i < 200; i++)
+    {
+        var buffer = new ArrayBuffer(1024 + i);
+        var view = new Uint8Array(buffer);
+        view[0] = round;
+        view[view.length - 1] = i & 0xff;
+        if (i % 50 == 0)
+        {
+            live.push(view);
+        }
+    }
+    CollectGarbage();
+}
+
+var failed = false;
+for (var j = 0; j < live.length; j++)
+{
+    var view = live[j];
+    var round = Math.floor(j / 4);
+    var i = (j % 4) * 50;
+    if (view.length != 1024 + i || view[0] != round || view[view.length - 1] != (i & 0xff))
+    {
+        failed = true;
+        WScript.Echo("FAILED: buffer " + j);
+    }
+}
+
+WScript.Echo(failed ? "FAILED" : "PASSED");